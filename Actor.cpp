@@ -18,7 +18,7 @@ float Actor::GetHealth() const
 	return m_Health;
 }
 
-float Actor::GetFeetCoordinate()
+float Actor::GetFeetCoordinate() const
 {
 	return GetPos().y + HalfOf(GetHeight());
 }
@@ -12,7 +12,7 @@ class Actor : public Movable
 {
 public:
 	float GetHealth() const;
-	float GetFeetCoordinate();
+	float GetFeetCoordinate() const;
 	void TakeDamage(int value, bool resetHitTimer = true);
 	void RestoreHealth(float value);
 	void StunFor(float value);
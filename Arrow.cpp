@@ -22,7 +22,7 @@ void Arrow::HitWall(sf::Vector2f hitPos)
 {
 	Projectile::HitWall(hitPos);
 	// Make arrow look broken on a random side
-	if (GetRandomBool()) { FlipSpriteVertically(); }
+	if (GetRandomBool(RandomStream::WEAPONS)) { FlipSpriteVertically(); }
 }
 
 const std::string Arrow::GetClassName() const
@@ -0,0 +1,273 @@
+// Times sudoku generation and the solver backends on fixed corpora, without opening a window
+// Usage: Benchmark <output file> [samples] [seed]
+// Results are written as JSON, one line per operation and corpus, so the files of two builds can be diffed
+// The results name the instruction set SimdSolver was built for, so builds for different targets are not mixed up
+// The seed defaults to a fixed value so the random corpora are the same from one build to the next
+#include "Board.h"					// also includes "Board_info.h"
+#include "SimdSolver.h"
+#include "DlxSolver.h"
+#include "PuzzlePool.h"				// for GenerateBoard()
+#include "SeedSolutions_info.h"		// for GetNumberOfSeedSolutions() and GetSeedSolution()
+#include "Difficulty_info.h"		// for GetDifficultyString() and GetNumberOfDifficulties()
+#include "Level_info.h"				// for GetFirstLevel(), GetNumberOfLevels() and GetAmountOfNumbersToHide()
+#include "Random.h"					// for SeedRandomStreams()
+#include <algorithm>				// for nth_element()
+#include <chrono>					// for steady_clock
+#include <cstdlib>					// for atoi(), strtoull(), malloc() and free()
+#include <fstream>					// for ofstream
+#include <iostream>					// for cout and cerr
+#include <new>						// for bad_alloc
+#include <string>
+#include <vector>
+
+static constexpr auto USAGE = "Usage: Benchmark <output file> [samples] [seed]";
+static constexpr auto DEFAULT_SAMPLES = 500;
+static constexpr auto DEFAULT_SEED = 1ull;
+static constexpr auto RANDOM_PUZZLES_PER_DIFFICULTY = 64;
+static constexpr auto GRID_CHARACTER_OFFSET = '0';
+static constexpr auto SOLUTIONS_FOR_UNIQUENESS = 2;
+static constexpr auto NANOSECONDS_PER_SECOND = 1e9;
+
+// Minimal 17 clue puzzles, from Gordon Royle's collection
+static constexpr const char* SEVENTEEN_CLUE_PUZZLES[] =
+{
+	"000000010400000000020000000000050407008000300001090000300400200050100000000806000",
+	"000000010400000000020000000000050604008000300001090000300400200050100000000807000",
+	"000000012000035000000600070700000300000400800100000000000120000080000040050000600",
+	"000000012003600000000007000410020000000500300700000600280000040000300500000000000",
+	"000000012008030000000000040120500000000004700060000000507000300000620000000100000",
+	"000000012040050000000009000070600400000100000000000050000087500601000300200000000",
+	"000000012050400000000000030700600400001000000000080000920000800000510700000003000",
+	"000000012300000060000040000900000500000001070020000000000350400001400800060000000",
+	"400000805030000000000700000020000060000080400000010000000603070500200000104000000",
+	"000000000000003085001020000000507000004000100090000000500000073002010000000040009",
+};
+
+// Puzzles known for needing the deepest searches: Arto Inkala's, Easter Monster, Golden Nugget and AI Escargot
+static constexpr const char* HARDEST_PUZZLES[] =
+{
+	"800000000003600000070090200050007000000045700000100030001000068008500010090000400",
+	"100000002090400050006000700050903000000070000000850040700000600030009080002000001",
+	"000000039000001005003050800008090006070002000100400000009080050020000600400700000",
+	"100007090030020008009600500005300900010080002600004000300000010040000007007000300",
+};
+
+// Every allocation in the process goes through here, so each benchmark can report how many it caused
+static std::size_t s_AllocationCount = 0;
+
+void* operator new(std::size_t size)
+{
+	s_AllocationCount++;
+	if (auto* pMemory = std::malloc(size == 0 ? 1 : size)) { return pMemory; }
+	throw std::bad_alloc();
+}
+
+void operator delete(void* pMemory) noexcept
+{
+	std::free(pMemory);
+}
+
+void operator delete(void* pMemory, std::size_t) noexcept
+{
+	std::free(pMemory);
+}
+
+struct Corpus
+{
+	std::string name;
+	std::vector<SudokuGrid> puzzles;
+};
+
+struct BenchmarkResult
+{
+	std::string operation;
+	std::string corpus;
+	int samples;
+	double medianNanoseconds;
+	double p99Nanoseconds;
+	double operationsPerSecond;
+	double allocationsPerOperation;
+};
+
+using Clock = std::chrono::steady_clock;
+
+static double GetNanosecondsBetween(Clock::time_point start, Clock::time_point end)
+{
+	return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+// Partially reorders the latencies in place, only the element at the percentile ends up where a full sort would put it
+static double GetPercentile(std::vector<double>& rLatencies, double percentile)
+{
+	auto index = static_cast<size_t>(percentile * (rLatencies.size() - 1));
+	std::nth_element(rLatencies.begin(), rLatencies.begin() + index, rLatencies.end());
+	return rLatencies[index];
+}
+
+static SudokuGrid ParsePuzzle(const char* pPuzzle)
+{
+	SudokuGrid grid;
+	for (auto cell = 0; cell < BOARD_CELLS; cell++) { grid[cell] = static_cast<std::uint8_t>(pPuzzle[cell] - GRID_CHARACTER_OFFSET); }
+	return grid;
+}
+
+template<size_t Count>
+static Corpus CreateCorpus(std::string name, const char* const (&puzzles)[Count])
+{
+	Corpus corpus = { name, {} };
+	for (auto* pPuzzle : puzzles) { corpus.puzzles.push_back(ParsePuzzle(pPuzzle)); }
+	return corpus;
+}
+
+// Generated the same way as the game does, spread evenly over the levels
+static Corpus CreateRandomCorpus(int difficulty)
+{
+	Corpus corpus = { "random " + GetDifficultyString(difficulty), {} };
+	Board board;
+	for (auto i = 0; i < RANDOM_PUZZLES_PER_DIFFICULTY; i++)
+	{
+		PuzzlePool::GenerateBoard(board, difficulty, GetFirstLevel() + i % GetNumberOfLevels());
+		corpus.puzzles.push_back(board.GetGivenGrid());
+	}
+	return corpus;
+}
+
+// Calls prepare(sample) then operation(sample) once per sample, and times each operation call on its own
+// Only the operation calls count towards the latencies, throughput and allocations
+// One untimed call goes first, so tables built on first use are not part of the results
+template<typename Prepare, typename Operation>
+static BenchmarkResult RunBenchmark(std::string operationName, std::string corpusName, int samples, Prepare prepare, Operation operation)
+{
+	std::vector<double> latencies;
+	latencies.reserve(samples);
+	prepare(0);
+	operation(0);
+
+	std::size_t allocations = 0;
+	auto totalNanoseconds = 0.0;
+	for (auto sample = 0; sample < samples; sample++)
+	{
+		prepare(sample);
+		auto allocationsBefore = s_AllocationCount;
+		auto callStart = Clock::now();
+		operation(sample);
+		auto latency = GetNanosecondsBetween(callStart, Clock::now());
+		allocations += s_AllocationCount - allocationsBefore;
+		totalNanoseconds += latency;
+		latencies.push_back(latency);
+	}
+
+	BenchmarkResult result = { operationName, corpusName, samples, 0.0, 0.0, 0.0, 0.0 };
+	result.medianNanoseconds = GetPercentile(latencies, 0.50);
+	result.p99Nanoseconds = GetPercentile(latencies, 0.99);
+	result.operationsPerSecond = samples * NANOSECONDS_PER_SECOND / totalNanoseconds;
+	result.allocationsPerOperation = static_cast<double>(allocations) / samples;
+
+	std::cout << "  " << operationName << " (" << corpusName << "): median " << result.medianNanoseconds / 1000.0
+		<< " us, p99 " << result.p99Nanoseconds / 1000.0 << " us, " << result.operationsPerSecond << " ops/sec, "
+		<< result.allocationsPerOperation << " allocations/op\n";
+	return result;
+}
+
+template<typename Operation>
+static BenchmarkResult RunBenchmark(std::string operationName, std::string corpusName, int samples, Operation operation)
+{
+	return RunBenchmark(operationName, corpusName, samples, [](int) {}, operation);
+}
+
+static void RunGeneratorBenchmarks(int samples, std::vector<BenchmarkResult>& rResults)
+{
+	Board board;
+	rResults.push_back(RunBenchmark("GenerateNewSudoku", "backtracking", samples, [&](int) { board.GenerateNewSudoku(); }));
+	rResults.push_back(RunBenchmark("GenerateNewSudoku", "seed solutions", samples,
+		[&](int sample) { board.GenerateNewSudoku(GetSeedSolution(sample % GetNumberOfSeedSolutions())); }));
+
+	// Hide cells on copies of the same full boards, so every difficulty starts from identical grids
+	// The copy is made before the timed call
+	std::vector<Board> fullBoards(GetNumberOfSeedSolutions());
+	for (auto i = 0; i < GetNumberOfSeedSolutions(); i++) { fullBoards[i].GenerateNewSudoku(GetSeedSolution(i)); }
+
+	for (auto difficulty = 0; difficulty < GetNumberOfDifficulties(); difficulty++)
+	{
+		rResults.push_back(RunBenchmark("HideCells", GetDifficultyString(difficulty), samples,
+			[&](int sample) { board = fullBoards[sample % fullBoards.size()]; },
+			[&](int sample) { board.HideCells(GetAmountOfNumbersToHide(difficulty, GetFirstLevel() + sample % GetNumberOfLevels())); }));
+	}
+}
+
+static void RunSolverBenchmarks(const std::string& solverName, SudokuSolver& rSolver, const std::vector<Corpus>& corpora,
+	int samples, std::vector<BenchmarkResult>& rResults)
+{
+	SudokuGrid solution;
+	for (const auto& corpus : corpora)
+	{
+		auto& puzzles = corpus.puzzles;
+		rResults.push_back(RunBenchmark(solverName + " Solve", corpus.name, samples,
+			[&](int sample) { rSolver.Solve(puzzles[sample % puzzles.size()], solution); }));
+		rResults.push_back(RunBenchmark(solverName + " CountSolutions", corpus.name, samples,
+			[&](int sample) { rSolver.CountSolutions(puzzles[sample % puzzles.size()], SOLUTIONS_FOR_UNIQUENESS); }));
+	}
+}
+
+static bool WriteResults(const std::string& filename, std::uint64_t seed, int samples, const std::vector<BenchmarkResult>& results)
+{
+	std::ofstream file(filename);
+	if (!file.is_open()) { return false; }
+
+	file << "{\n  \"seed\": " << seed << ",\n  \"samples\": " << samples << ",\n  \"simd_solver_instruction_set\": \""
+		<< SimdSolver::GetInstructionSet() << "\",\n  \"results\": [\n";
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		const auto& result = results[i];
+		file << "    { \"operation\": \"" << result.operation << "\", \"corpus\": \"" << result.corpus << "\""
+			<< ", \"median_ns\": " << result.medianNanoseconds << ", \"p99_ns\": " << result.p99Nanoseconds
+			<< ", \"ops_per_sec\": " << result.operationsPerSecond << ", \"allocations_per_op\": " << result.allocationsPerOperation << " }"
+			<< (i + 1 < results.size() ? ",\n" : "\n");
+	}
+	file << "  ]\n}\n";
+
+	return file.good();
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2 || argc > 4)
+	{
+		std::cerr << USAGE << "\n";
+		return EXIT_FAILURE;
+	}
+
+	std::string filename = argv[1];
+	auto samples = (argc >= 3) ? std::atoi(argv[2]) : DEFAULT_SAMPLES;
+	auto seed = (argc == 4) ? std::strtoull(argv[3], nullptr, 10) : DEFAULT_SEED;
+	if (samples <= 0)
+	{
+		std::cerr << USAGE << "\n";
+		return EXIT_FAILURE;
+	}
+	SeedRandomStreams(seed);
+
+	std::vector<Corpus> corpora;
+	corpora.push_back(CreateCorpus("17 clues", SEVENTEEN_CLUE_PUZZLES));
+	corpora.push_back(CreateCorpus("hardest", HARDEST_PUZZLES));
+	for (auto difficulty = 0; difficulty < GetNumberOfDifficulties(); difficulty++) { corpora.push_back(CreateRandomCorpus(difficulty)); }
+
+	std::cout << "Running " << samples << " samples per benchmark with seed " << seed << ", SimdSolver built for "
+		<< SimdSolver::GetInstructionSet() << "\n";
+
+	std::vector<BenchmarkResult> results;
+	RunGeneratorBenchmarks(samples, results);
+	SimdSolver simdSolver;
+	RunSolverBenchmarks("SimdSolver", simdSolver, corpora, samples, results);
+	DlxSolver dlxSolver;
+	RunSolverBenchmarks("DlxSolver", dlxSolver, corpora, samples, results);
+
+	if (!WriteResults(filename, seed, samples, results))
+	{
+		std::cerr << "Could not write results to " << filename << "\n";
+		return EXIT_FAILURE;
+	}
+	std::cout << "Wrote " << results.size() << " results to " << filename << "\n";
+
+	return EXIT_SUCCESS;
+}
\ No newline at end of file
@@ -1,75 +1,87 @@
 #include "Board.h"
+#include "DlxSolver.h"							// for Solve() and CountSolutions()
+#include "SimdSolver.h"							// for CountSolutions()
+#include "GridTransform.h"						// for CreateRandom() and Apply()
 #include "Random.h"								// for GetRandomNumberBetween()
-#include "TextPrinting.h"						// for GetFontPath() and PrintText()
 #include "ErrorLogging.h"						// for Assert()
-#include <SFML/Graphics/RectangleShape.hpp>		// for gridlines
-
-static constexpr auto CELL_FONT_FILENAME = "Opensticks";
-static constexpr auto CELL_TEXT_SIZE = 40;
-static constexpr auto CELL_TEXT_STYLE = TextStyle::BOLD;
-static inline const auto CELL_TEXT_COLOR_HIDDEN = sf::Color::White;
-static inline const auto CELL_TEXT_COLOR_NOT_HIDDEN = sf::Color(0, 0, 0, 200);
-static inline const auto GRIDLINE_COLOR = sf::Color::Black;
-static constexpr auto GRIDLINE_THICKNESS = 1.0f;
-static constexpr auto ERROR_CELL_OUT_OF_RANGE = "Cell index is out of range - value must be between 0 and 80.";
-static constexpr auto ERROR_ROW_OUT_OF_RANGE = "Row index is out of range - value must be between 0 and 8.";
-static constexpr auto ERROR_COLUMN_OUT_OF_RANGE = "Column index is out of range - value must be between 0 and 8.";
-static constexpr auto ERROR_AMOUNT_TO_HIDE_OUT_OF_RANGE = "Amount of cells to hide is out of range - value must be between 1 and 81.";
+#include <memory>								// for make_unique()
+#include <type_traits>							// for is_trivially_copyable_v and conditional_t
+
+static constexpr auto FILL_SEARCH_STEP_LIMIT = 5000;
+static constexpr auto ERROR_AMOUNT_TO_HIDE_OUT_OF_RANGE = "Amount of cells to hide is out of range - value must be between 1 and BOARD_CELLS.";
 static constexpr auto ERROR_AMOUNT_TO_HIDE_GREATER_THAN_CELLS_NOT_HIDDEN = "Amount of cells to hide is greater than remaining cells not hidden - use value <= to GetAmountOfCellsNotHidden() return value.";
 static constexpr auto ERROR_NO_INCORRECT_CELLS = "No more incorrect cells, sudoku has been solved - use IsSolutionCorrect() to check before calling GetRandomIncorrectCellIndex().";
 
-static int CalcBox(int index)
-{
-	return index / BOARD_SIZE;
-}
+// The bitboard solver only handles 9x9 boards, bigger ones fall back to dancing links
+template<int BoxSize>
+using UniquenessSolver = std::conditional_t<BoxSize == BOX_SIZE, SimdSolver, BasicDlxSolver<BoxSize>>;
 
-static int CalcBox(int row, int column)
+template<int BoxSize>
+BasicBoard<BoxSize>::BasicBoard() :
+	m_SudokuCells(),
+	m_RowMasks(),
+	m_ColumnMasks(),
+	m_BoxMasks(),
+	m_HiddenCellCount(),
+	m_EmptyCellCount(),
+	m_IncorrectCells(),
+	m_GuessCounts(),
+	m_ConflictMasks(),
+	m_ConflictingCells(),
+	m_ShownMasks(),
+	m_HintedCellIndex(NO_HINTED_CELL),
+	m_Revision()
 {
-	return (row / BOX_SIZE) * BOX_SIZE + (column / BOX_SIZE);
 }
 
-static void PrintGridline(sf::RenderWindow& rWindow, sf::Vector2f position, sf::Vector2f dimensions)
+template<int BoxSize>
+void BasicBoard<BoxSize>::GenerateNewSudoku()
 {
-	sf::RectangleShape gridLine;
-	gridLine.setFillColor(GRIDLINE_COLOR);
-	gridLine.setPosition(position);
-	gridLine.setSize(dimensions);
-	rWindow.draw(gridLine);
+	for (auto& cell : m_SudokuCells) { cell.Reset(); }
+	m_RowMasks.fill(NO_CANDIDATES);
+	m_ColumnMasks.fill(NO_CANDIDATES);
+	m_BoxMasks.fill(NO_CANDIDATES);
+
+	// Backtracking a cell at a time stalls on bigger boards, the exact cover solver handles those
+	if constexpr (BOX_SIZE > 3) { FillBySolvingSeededBoxes(); }
+	else { FillByBacktracking(); }
+
+	// Reset counts
+	m_HiddenCellCount = 0;
+	m_EmptyCellCount = 0;
+	m_IncorrectCells.Clear();
+	RecountGuesses();
+	StampRevision();
 }
 
-Board::Board() :
-	m_SudokuCells(),
-	m_HiddenCellCount(),
-	m_EmptyCellCount(),
-	m_CorrectCellCount()
+template<int BoxSize>
+void BasicBoard<BoxSize>::GenerateNewSudoku(const Grid& seedSolution)
 {
-	ms_CellsFont.loadFromFile(GetFontPath(CELL_FONT_FILENAME));
+	// Nothing hidden, so the solution doubles as the givens
+	auto solution = BasicGridTransform<BoxSize>::CreateRandom().Apply(seedSolution);
+	LoadSudoku(solution, solution);
 }
 
-void Board::GenerateNewSudoku()
+template<int BoxSize>
+void BasicBoard<BoxSize>::FillByBacktracking()
 {
-	m_SudokuCells.clear();
-	m_SudokuCells.resize(BOARD_CELLS);
-
-	// Loop through all cells (0 to 80)
-	for (auto cell_it = m_SudokuCells.begin(); cell_it != m_SudokuCells.end(); cell_it++)
+	// Loop through all cells (0 to BOARD_CELLS - 1)
+	for (auto index = 0; index < BOARD_CELLS; index++)
 	{
 		auto validValue = false;
 
 		// Found a valid value yet ?
 		while (!validValue)
 		{
-			// Calculate current cell index
-			// Needs to be calculculated inside the loop in case we backtrack
-			auto index = distance(m_SudokuCells.begin(), cell_it);
-			auto& cell = m_SudokuCells.at(index);
+			auto& cell = m_SudokuCells[index];
 
 			// No more value candidates to try ?
 			if (cell.RanOutOfCandidates())
 			{
 				cell.Reset();
-				// Backtrack to previous cell
-				cell_it--;
+				// Backtrack to previous cell and free up its value, its remaining candidates are kept
+				index--;
+				RemoveValue(index);
 			}
 			// Try next random candidate
 			else
@@ -77,201 +89,441 @@ void Board::GenerateNewSudoku()
 				auto candidate = cell.GetRandomAvailableCandidate();
 				// Would candidate be valid in column/row/box ?
 				validValue = IsColumnValid(candidate, index) && IsRowValid(candidate, index) && IsBoxValid(candidate, index);
-				if (validValue) { cell.SetValue(candidate); }
+				if (validValue) { PlaceValue(candidate, index); }
 			}
 		}
 	}
+}
 
-	// Reset counts
-	m_HiddenCellCount = 0;
-	m_EmptyCellCount = 0;
-	m_CorrectCellCount = BOARD_CELLS;
+template<int BoxSize>
+void BasicBoard<BoxSize>::FillBySolvingSeededBoxes()
+{
+	// One solver per thread, its link matrix is reused for every board
+	static thread_local auto pFillSolver = std::make_unique<BasicDlxSolver<BoxSize>>();
+	Grid seeded;
+	Grid solution;
+
+	// A few seeds send the search down a long dead end, start over with new ones instead of waiting
+	do
+	{
+		seeded.fill(EMPTY_CELL_VALUE);
+		// Boxes on the diagonal share no row or column, so each can hold any shuffle of the values
+		for (auto box = 0; box < BOX_SIZE; box++)
+		{
+			std::array<int, BOARD_SIZE> values;
+			for (auto i = 0; i < BOARD_SIZE; i++) { values[i] = i + 1; }
+			for (auto i = BOARD_SIZE - 1; i > 0; i--) { std::swap(values[i], values[GetRandomNumberBetween(0, i, RandomStream::BOARD)]); }
+			for (auto i = 0; i < BOARD_SIZE; i++)
+			{
+				auto row = box * BOX_SIZE + i / BOX_SIZE;
+				auto column = box * BOX_SIZE + i % BOX_SIZE;
+				seeded[row * BOARD_SIZE + column] = static_cast<std::uint8_t>(values[i]);
+			}
+		}
+	} while (!pFillSolver->Solve(seeded, solution, FILL_SEARCH_STEP_LIMIT));
+
+	for (auto index = 0; index < BOARD_CELLS; index++)
+		PlaceValue(solution[CalcGridIndex(index)], index);
 }
 
-void Board::HideCells(int amountToHide)
+// Only hides a cell if the sudoku still has exactly one solution afterwards
+// Returns false if no more cells can be hidden before reaching the amount, a new sudoku should be generated then
+template<int BoxSize>
+bool BasicBoard<BoxSize>::HideCells(int amountToHide)
 {
 	Assert(ERROR_AMOUNT_TO_HIDE_OUT_OF_RANGE, amountToHide > 0 && amountToHide <= BOARD_CELLS);
 	Assert(ERROR_AMOUNT_TO_HIDE_GREATER_THAN_CELLS_NOT_HIDDEN, amountToHide <= GetVisibleCellCount());
+	// One solver per thread, its link matrix is reused for every check
+	static thread_local auto pUniquenessSolver = std::make_unique<UniquenessSolver<BoxSize>>();
 	auto hiddenSoFar = 0;
-	int index;
-	// Populate a set with all indeces
-	std::set<int> indeces;
-	for (auto i = 0; i < static_cast<int>(m_SudokuCells.size()) - 1; i++) { indeces.insert(i); }
+	auto givens = GetGivenGrid();
+
+	// Shuffle all indeces to try hiding them in a random order
+	std::array<int, BOARD_CELLS> indeces;
+	for (auto i = 0; i < BOARD_CELLS; i++) { indeces[i] = i; }
+	for (auto i = BOARD_CELLS - 1; i > 0; i--) { std::swap(indeces[i], indeces[GetRandomNumberBetween(0, i, RandomStream::BOARD)]); }
 
 	// Hidden enough cells yet ?
-	while (hiddenSoFar < amountToHide)
+	for (auto i = 0; i < BOARD_CELLS && hiddenSoFar < amountToHide; i++)
 	{
-		// Pick a random cell
-		index = TakeRandomElementFromSet(indeces);
+		auto index = indeces[i];
+		auto& cell = m_SudokuCells[index];
 
 		// Already hidden ?
-		if (!m_SudokuCells.at(index).IsHidden())
+		if (cell.IsHidden()) { continue; }
+
+		// Would the sudoku still have a unique solution ? Stop counting as soon as a second one is found
+		auto& given = givens[CalcGridIndex(index)];
+		given = EMPTY_CELL_VALUE;
+		if (pUniquenessSolver->CountSolutions(givens, 2) == 1)
 		{
-			m_SudokuCells.at(index).Hide();
+			cell.Hide();
+			RemoveGuessFromUnits(cell.GetValue(), index);
 			hiddenSoFar++;
 			m_HiddenCellCount++;
 			m_EmptyCellCount++;
-			m_CorrectCellCount--;
+			m_IncorrectCells.Insert(index);
 		}
+		// Put it back
+		else { given = static_cast<std::uint8_t>(cell.GetValue()); }
 	}
+
+	StampRevision();
+	return hiddenSoFar == amountToHide;
 }
 
-void Board::ClearCellGuess(int index)
+template<int BoxSize>
+void BasicBoard<BoxSize>::LoadSudoku(const Grid& givens, const Grid& solution)
+{
+	for (auto& cell : m_SudokuCells) { cell.Reset(); }
+	m_RowMasks.fill(NO_CANDIDATES);
+	m_ColumnMasks.fill(NO_CANDIDATES);
+	m_BoxMasks.fill(NO_CANDIDATES);
+	m_HiddenCellCount = 0;
+	m_IncorrectCells.Clear();
+
+	for (auto index = 0; index < BOARD_CELLS; index++)
+	{
+		auto gridIndex = CalcGridIndex(index);
+		PlaceValue(solution[gridIndex], index);
+
+		if (givens[gridIndex] == EMPTY_CELL_VALUE)
+		{
+			m_SudokuCells[index].Hide();
+			m_HiddenCellCount++;
+			m_IncorrectCells.Insert(index);
+		}
+	}
+
+	m_EmptyCellCount = m_HiddenCellCount;
+	RecountGuesses();
+	StampRevision();
+}
+
+template<int BoxSize>
+void BasicBoard<BoxSize>::ClearCellGuess(int index)
 {
 	Assert(ERROR_CELL_OUT_OF_RANGE, index >= 0 && index < BOARD_CELLS);
+	auto oldGuess = m_SudokuCells.at(index).GetGuess();
 	if (!IsCellEmpty(index)) { m_EmptyCellCount++; } // dont decrement if cell was already empty
-	if (m_SudokuCells.at(index).IsGuessCorrect()) { m_CorrectCellCount--; } // decrement if correct guess was cleared
 	m_SudokuCells.at(index).ClearGuess();
+	m_IncorrectCells.Insert(index);
+	if (oldGuess != EMPTY_CELL_VALUE) { RemoveGuessFromUnits(oldGuess, index); }
+	StampRevision();
 }
 
-void Board::EnterCellGuess(int index, int value)
+template<int BoxSize>
+void BasicBoard<BoxSize>::EnterCellGuess(int index, int value)
 {
 	Assert(ERROR_CELL_OUT_OF_RANGE, index >= 0 && index < BOARD_CELLS);
+	auto oldGuess = m_SudokuCells.at(index).GetGuess();
+	if (oldGuess == value) { return; }
 	if (IsCellEmpty(index)) { m_EmptyCellCount--; } // dont decrement if cell already had another guess
-	if (m_SudokuCells.at(index).IsGuessCorrect()) { m_CorrectCellCount--; } // decrement if correct guess was changed
 	m_SudokuCells.at(index).SetGuess(value);
-	if (m_SudokuCells.at(index).IsGuessCorrect()) { m_CorrectCellCount++; } // increment if new guess is correct
+	UpdateCellCorrectness(index);
+	if (oldGuess != EMPTY_CELL_VALUE) { RemoveGuessFromUnits(oldGuess, index); }
+	AddGuessToUnits(value, index);
+	StampRevision();
 }
 
-bool Board::IsSolutionCorrect() const
+template<int BoxSize>
+bool BasicBoard<BoxSize>::IsSolutionCorrect() const
 {
-	return m_CorrectCellCount == BOARD_CELLS;
+	return m_IncorrectCells.IsEmpty();
 }
 
-bool Board::IsCellHidden(int index) const
+template<int BoxSize>
+bool BasicBoard<BoxSize>::IsCellHidden(int index) const
 {
 	Assert(ERROR_CELL_OUT_OF_RANGE, index >= 0 && index < BOARD_CELLS);
 	return m_SudokuCells.at(index).IsHidden();
 }
 
-bool Board::IsCellEmpty(int index) const
+template<int BoxSize>
+bool BasicBoard<BoxSize>::IsCellEmpty(int index) const
 {
 	Assert(ERROR_CELL_OUT_OF_RANGE, index >= 0 && index < BOARD_CELLS);
 	return m_SudokuCells.at(index).IsGuessClear();
 }
 
-int Board::CalcIndex(int row, int column) const
+template<int BoxSize>
+bool BasicBoard<BoxSize>::IsCellInConflict(int index) const
+{
+	Assert(ERROR_CELL_OUT_OF_RANGE, index >= 0 && index < BOARD_CELLS);
+	return m_ConflictingCells.Contains(index);
+}
+
+// Cells with a wrong guess and empty cells are considered incorrect
+template<int BoxSize>
+int BasicBoard<BoxSize>::GetRandomIncorrectCellIndex() const
+{
+	Assert(ERROR_NO_INCORRECT_CELLS, !IsSolutionCorrect());
+	return m_IncorrectCells.GetRandom(RandomStream::AI);
+}
+
+template<int BoxSize>
+int BasicBoard<BoxSize>::GetVisibleCellCount() const
+{
+	return BOARD_CELLS - m_HiddenCellCount;
+}
+
+template<int BoxSize>
+int BasicBoard<BoxSize>::GetIncorrectCellCount() const
+{
+	return m_IncorrectCells.GetSize();
+}
+
+template<int BoxSize>
+int BasicBoard<BoxSize>::GetConflictingCellCount() const
+{
+	return m_ConflictingCells.GetSize();
+}
+
+template<int BoxSize>
+typename BasicBoard<BoxSize>::CellList BasicBoard<BoxSize>::GetConflictingCells() const
 {
-	Assert(ERROR_ROW_OUT_OF_RANGE, row >=0 && row  < BOARD_SIZE);
-	Assert(ERROR_COLUMN_OUT_OF_RANGE, column >=0 && column < BOARD_SIZE);
-	auto box = CalcBox(row, column);
-	auto index = (BOX_SIZE * row) + column + box * (BOARD_SIZE - BOX_SIZE);
-	return index;
+	return m_ConflictingCells.GetElements();
 }
 
-int Board::CalcRow(int index) const
+template<int BoxSize>
+typename BasicBoard<BoxSize>::Mask BasicBoard<BoxSize>::GetCellCandidates(int index) const
 {
 	Assert(ERROR_CELL_OUT_OF_RANGE, index >= 0 && index < BOARD_CELLS);
-	auto box = CalcBox(index);
-	auto withinBoxRow = (index % BOARD_SIZE) / BOX_SIZE;
-	auto additionalRows = (box / BOX_SIZE) * BOX_SIZE;
-	return withinBoxRow + additionalRows;
+	if (!IsCellEmpty(index)) { return NO_CANDIDATES; }
+
+	auto shown = static_cast<Mask>(NO_CANDIDATES);
+	for (auto unit : UNITS) { shown |= m_ShownMasks[static_cast<int>(unit)][CalcUnit(unit, index)]; }
+	return static_cast<Mask>(BoardTraits<BoxSize>::ALL_CANDIDATES & ~shown);
 }
 
-int Board::CalcColumn(int index) const
+template<int BoxSize>
+void BasicBoard<BoxSize>::TogglePencilMark(int index, int value)
 {
 	Assert(ERROR_CELL_OUT_OF_RANGE, index >= 0 && index < BOARD_CELLS);
-	auto box = CalcBox(index);
-	auto withinBoxColumn = index % BOX_SIZE;
-	auto additionalColumns = (box % BOX_SIZE) * BOX_SIZE;
-	return withinBoxColumn + additionalColumns;
+	if (!IsCellEmpty(index)) { return; } // marks under a guess are hidden, so editing them would go unseen
+	m_SudokuCells.at(index).TogglePencilMark(value);
+	StampRevision();
 }
 
-// Cells with a wrong guess and empty cells are considered incorrect
-int Board::GetRandomIncorrectCellIndex() const
+template<int BoxSize>
+void BasicBoard<BoxSize>::ClearPencilMarks(int index)
 {
-	Assert(ERROR_NO_INCORRECT_CELLS, !IsSolutionCorrect());
-	int index;
-	// Populate a set with all indeces
-	std::set<int> indeces;
-	for (auto i = 0; i < static_cast<int>(m_SudokuCells.size()) - 1; i++) { indeces.insert(i); }
-	
-	do
-	{
-		// Pick a random cell
-		index = TakeRandomElementFromSet(indeces);
-	}
-	while (m_SudokuCells.at(index).IsGuessCorrect());
+	Assert(ERROR_CELL_OUT_OF_RANGE, index >= 0 && index < BOARD_CELLS);
+	m_SudokuCells.at(index).SetPencilMarks(NO_CANDIDATES);
+	StampRevision();
+}
 
-	return index;
+// The shown masks are kept up to date on every guess, so this is a few lookups per cell
+template<int BoxSize>
+void BasicBoard<BoxSize>::FillPencilMarks()
+{
+	for (auto index = 0; index < BOARD_CELLS; index++)
+		if (IsCellHidden(index) && IsCellEmpty(index)) { m_SudokuCells[index].SetPencilMarks(GetCellCandidates(index)); }
+	StampRevision();
 }
 
-int Board::GetVisibleCellCount() const
+template<int BoxSize>
+typename BasicBoard<BoxSize>::Mask BasicBoard<BoxSize>::GetPencilMarks(int index) const
 {
-	return BOARD_CELLS - m_HiddenCellCount;
+	Assert(ERROR_CELL_OUT_OF_RANGE, index >= 0 && index < BOARD_CELLS);
+	return m_SudokuCells.at(index).GetPencilMarks();
 }
 
-int Board::GetIncorrectCellCount() const
+template<int BoxSize>
+void BasicBoard<BoxSize>::SetHintedCell(int index)
 {
-	return BOARD_CELLS - m_CorrectCellCount;
+	Assert(ERROR_CELL_OUT_OF_RANGE, index >= 0 && index < BOARD_CELLS);
+	m_HintedCellIndex = index;
+	StampRevision();
+}
+
+template<int BoxSize>
+int BasicBoard<BoxSize>::GetHintedCellIndex() const
+{
+	return m_HintedCellIndex;
 }
 
-void Board::Draw(sf::RenderWindow& rWindow, float cellSize, sf::Vector2f firstCellPos) const
+template<int BoxSize>
+std::uint32_t BasicBoard<BoxSize>::GetRevision() const
 {
-	sf::Color color;
-	sf::Vector2f alignment;
+	return m_Revision;
+}
+
+template<int BoxSize>
+typename BasicBoard<BoxSize>::Grid BasicBoard<BoxSize>::GetSolutionGrid() const
+{
+	Grid grid;
+	for (auto r = 0; r < BOARD_SIZE; r++)
+		for (auto c = 0; c < BOARD_SIZE; c++)
+			grid[r * BOARD_SIZE + c] = static_cast<std::uint8_t>(m_SudokuCells[CalcIndex(r, c)].GetValue());
+	return grid;
+}
 
+template<int BoxSize>
+typename BasicBoard<BoxSize>::Grid BasicBoard<BoxSize>::GetGivenGrid() const
+{
+	Grid grid;
 	for (auto r = 0; r < BOARD_SIZE; r++)
 	{
 		for (auto c = 0; c < BOARD_SIZE; c++)
 		{
-			// Numbers
-			auto& curCell = m_SudokuCells.at(CalcIndex(r, c));
-			if (!curCell.IsGuessClear())
-			{
-				color = (curCell.IsHidden()) ? CELL_TEXT_COLOR_HIDDEN : CELL_TEXT_COLOR_NOT_HIDDEN;
-				alignment = sf::Vector2f((firstCellPos.x + c * cellSize) / rWindow.getSize().x, (firstCellPos.y + r * cellSize) / rWindow.getSize().y);
-				PrintText(rWindow, alignment, std::to_string(curCell.GetGuess()), CELL_TEXT_SIZE, color, ms_CellsFont, CELL_TEXT_STYLE);
-			}
-			// Gridlines
-			// Horizontal
-			if (c == 0 && r != 0 && r % BOX_SIZE == 0)
-				PrintGridline(rWindow, sf::Vector2f(firstCellPos.x - cellSize * 0.5f, firstCellPos.y + cellSize * (r - 0.5f)), sf::Vector2f(BOARD_SIZE * cellSize, GRIDLINE_THICKNESS));
-			// Vertical
-			else if (r == 0 && c != 0 && c % BOX_SIZE == 0)
-				PrintGridline(rWindow, sf::Vector2f(firstCellPos.x + cellSize * (c - 0.5f), firstCellPos.y - cellSize * 0.5f), sf::Vector2f(GRIDLINE_THICKNESS, BOARD_SIZE * cellSize));
+			auto& cell = m_SudokuCells[CalcIndex(r, c)];
+			grid[r * BOARD_SIZE + c] = static_cast<std::uint8_t>(cell.IsHidden() ? EMPTY_CELL_VALUE : cell.GetValue());
 		}
 	}
+	return grid;
+}
+
+template<int BoxSize>
+typename BasicBoard<BoxSize>::Grid BasicBoard<BoxSize>::GetGuessGrid() const
+{
+	Grid grid;
+	for (auto r = 0; r < BOARD_SIZE; r++)
+		for (auto c = 0; c < BOARD_SIZE; c++)
+			grid[r * BOARD_SIZE + c] = static_cast<std::uint8_t>(m_SudokuCells[CalcIndex(r, c)].GetGuess());
+	return grid;
+}
+
+template<int BoxSize>
+void BasicBoard<BoxSize>::PlaceValue(int value, int index)
+{
+	auto bit = GetCandidateBit<Mask>(value);
+	m_RowMasks[CalcRow(index)] |= bit;
+	m_ColumnMasks[CalcColumn(index)] |= bit;
+	m_BoxMasks[CalcBox(index)] |= bit;
+	m_SudokuCells[index].SetValue(value);
+}
+
+template<int BoxSize>
+void BasicBoard<BoxSize>::RemoveValue(int index)
+{
+	auto bit = GetCandidateBit<Mask>(m_SudokuCells[index].GetValue());
+	m_RowMasks[CalcRow(index)] &= ~bit;
+	m_ColumnMasks[CalcColumn(index)] &= ~bit;
+	m_BoxMasks[CalcBox(index)] &= ~bit;
+	m_SudokuCells[index].ClearValue();
 }
 
-bool Board::IsBoxValid(int value, int index) const
+template<int BoxSize>
+bool BasicBoard<BoxSize>::IsBoxValid(int value, int index) const
 {
-	Assert(ERROR_CELL_OUT_OF_RANGE, index >= 0 && index < BOARD_SIZE* BOARD_SIZE);
-	auto box = CalcBox(index);
+	Assert(ERROR_CELL_OUT_OF_RANGE, index >= 0 && index < BOARD_CELLS);
+	// Value already exists in box ?
+	return (m_BoxMasks[CalcBox(index)] & GetCandidateBit<Mask>(value)) == NO_CANDIDATES;
+}
+
+template<int BoxSize>
+bool BasicBoard<BoxSize>::IsRowValid(int value, int index) const
+{
+	// Value already exists in row ?
+	return (m_RowMasks[CalcRow(index)] & GetCandidateBit<Mask>(value)) == NO_CANDIDATES;
+}
+
+template<int BoxSize>
+bool BasicBoard<BoxSize>::IsColumnValid(int value, int index) const
+{
+	// Value already exists in column ?
+	return (m_ColumnMasks[CalcColumn(index)] & GetCandidateBit<Mask>(value)) == NO_CANDIDATES;
+}
 
-	// Check all cells in that box
-	for (auto i = 0 + (box * BOARD_SIZE); i < BOARD_SIZE + (box * BOARD_SIZE); i++)
+// Rebuilds the guess counts and conflicts from scratch, for when the whole board changes at once
+template<int BoxSize>
+void BasicBoard<BoxSize>::RecountGuesses()
+{
+	for (auto& unitCounts : m_GuessCounts)
+		for (auto& valueCounts : unitCounts) { valueCounts.fill(0); }
+	for (auto& unitMasks : m_ConflictMasks) { unitMasks.fill(NO_CANDIDATES); }
+	for (auto& unitMasks : m_ShownMasks) { unitMasks.fill(NO_CANDIDATES); }
+	m_ConflictingCells.Clear();
+
+	for (auto index = 0; index < BOARD_CELLS; index++)
+		if (!m_SudokuCells[index].IsGuessClear()) { AddGuessToUnits(m_SudokuCells[index].GetGuess(), index); }
+}
+
+// Only a count going from one to two, or back, changes which cells are in conflict
+// Only a count going from zero to one, or back, changes the candidates
+// Any change to what the board shows passes through here, so this is also where a hint goes stale
+template<int BoxSize>
+void BasicBoard<BoxSize>::AddGuessToUnits(int value, int index)
+{
+	m_HintedCellIndex = NO_HINTED_CELL;
+	for (auto unit : UNITS)
 	{
-		// Value already exists in box ?
-		if (m_SudokuCells.at(i).GetValue() == value) { return false; }
+		auto unitIndex = CalcUnit(unit, index);
+		auto& count = m_GuessCounts[static_cast<int>(unit)][unitIndex][value - 1];
+		if (++count == 1) { m_ShownMasks[static_cast<int>(unit)][unitIndex] |= GetCandidateBit<Mask>(value); }
+		else if (count == 2)
+		{
+			m_ConflictMasks[static_cast<int>(unit)][unitIndex] |= GetCandidateBit<Mask>(value);
+			UpdateUnitConflicts(unit, unitIndex, value);
+		}
 	}
-	return true;
+	UpdateCellConflict(index);
 }
 
-bool Board::IsRowValid(int value, int index) const
+// The cell's guess must already be changed so it is not counted as one of the remaining cells
+template<int BoxSize>
+void BasicBoard<BoxSize>::RemoveGuessFromUnits(int value, int index)
 {
-	Assert(ERROR_CELL_OUT_OF_RANGE, index >= 0 && index < BOARD_SIZE* BOARD_SIZE);
-	auto row = CalcRow(index);
-
-	// Check all cells in that row
-	for (auto c = 0; c < BOARD_SIZE; c++)
+	m_HintedCellIndex = NO_HINTED_CELL;
+	for (auto unit : UNITS)
 	{
-		// Value already exists in row ?
-		if (m_SudokuCells.at(CalcIndex(row, c)).GetValue() == value) { return false; }
+		auto unitIndex = CalcUnit(unit, index);
+		auto& count = m_GuessCounts[static_cast<int>(unit)][unitIndex][value - 1];
+		if (--count == 0) { m_ShownMasks[static_cast<int>(unit)][unitIndex] &= ~GetCandidateBit<Mask>(value); }
+		else if (count == 1)
+		{
+			m_ConflictMasks[static_cast<int>(unit)][unitIndex] &= ~GetCandidateBit<Mask>(value);
+			UpdateUnitConflicts(unit, unitIndex, value);
+		}
 	}
-	return true;
+	UpdateCellConflict(index);
 }
 
-bool Board::IsColumnValid(int value, int index) const
+template<int BoxSize>
+void BasicBoard<BoxSize>::UpdateUnitConflicts(Unit unit, int unitIndex, int value)
 {
-	Assert(ERROR_CELL_OUT_OF_RANGE, index >= 0 && index < BOARD_SIZE* BOARD_SIZE);
-	auto column = CalcColumn(index);
+	for (auto position = 0; position < BOARD_SIZE; position++)
+	{
+		auto index = CalcUnitCellIndex(unit, unitIndex, position);
+		if (m_SudokuCells[index].GetGuess() == value) { UpdateCellConflict(index); }
+	}
+}
 
-	// Check all cells in that column
-	for (auto r = 0; r < BOARD_SIZE; r++)
+template<int BoxSize>
+void BasicBoard<BoxSize>::UpdateCellConflict(int index)
+{
+	auto& cell = m_SudokuCells[index];
+	auto inConflict = false;
+	if (!cell.IsGuessClear())
 	{
-		// Value already exists in column ?
-		if (m_SudokuCells.at(CalcIndex(r, column)).GetValue() == value) { return false; }
+		auto bit = GetCandidateBit<Mask>(cell.GetGuess());
+		for (auto unit : UNITS)
+			inConflict |= (m_ConflictMasks[static_cast<int>(unit)][CalcUnit(unit, index)] & bit) != NO_CANDIDATES;
 	}
-	return true;
-}
\ No newline at end of file
+
+	if (inConflict) { m_ConflictingCells.Insert(index); }
+	else { m_ConflictingCells.Remove(index); }
+}
+
+template<int BoxSize>
+void BasicBoard<BoxSize>::UpdateCellCorrectness(int index)
+{
+	if (m_SudokuCells[index].IsGuessCorrect()) { m_IncorrectCells.Remove(index); }
+	else { m_IncorrectCells.Insert(index); }
+}
+
+template<int BoxSize>
+void BasicBoard<BoxSize>::StampRevision()
+{
+	m_Revision = ms_LastRevision.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+// Boards are copied around as plain values (e.g. when a new sudoku is generated)
+static_assert(std::is_trivially_copyable_v<BasicBoard<2>> && std::is_trivially_copyable_v<BasicBoard<3>>
+	&& std::is_trivially_copyable_v<BasicBoard<4>> && std::is_trivially_copyable_v<BasicBoard<5>>, "Board must stay trivially copyable - use fixed size members only.");
+
+template class BasicBoard<2>;
+template class BasicBoard<3>;
+template class BasicBoard<4>;
+template class BasicBoard<5>;
\ No newline at end of file
@@ -2,43 +2,219 @@
 #ifndef BOARD_H
 #define BOARD_H
 
-#include "Cell.h"
-#include <SFML/Graphics/Font.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
+#include "Cell.h"			// also includes "Board_info.h"
+#include "BoardTopology.h"	// for BOARD_TOPOLOGY
+#include "ErrorLogging.h"	// for Assert()
+#include "Random.h"			// for IndexableBag
+#include <atomic>
+#include <span>
+#include <type_traits>		// for is_constant_evaluated()
 
-static constexpr auto BOX_SIZE = 3;
-static constexpr auto BOARD_SIZE = BOX_SIZE * BOX_SIZE;
-static constexpr auto BOARD_CELLS = BOARD_SIZE * BOARD_SIZE;
+static constexpr auto ERROR_CELL_OUT_OF_RANGE = "Cell index is out of range - value must be between 0 and BOARD_CELLS - 1.";
+static constexpr auto ERROR_ROW_OUT_OF_RANGE = "Row index is out of range - value must be between 0 and BOARD_SIZE - 1.";
+static constexpr auto ERROR_COLUMN_OUT_OF_RANGE = "Column index is out of range - value must be between 0 and BOARD_SIZE - 1.";
+static constexpr auto NO_HINTED_CELL = -1;
 
-class Board
+template<int BoxSize>
+class BasicBoard
 {
 public:
-	Board();
+	static constexpr auto BOX_SIZE = BoardTraits<BoxSize>::BOX_SIZE;
+	static constexpr auto BOARD_SIZE = BoardTraits<BoxSize>::BOARD_SIZE;
+	static constexpr auto BOARD_CELLS = BoardTraits<BoxSize>::BOARD_CELLS;
+	using Mask = typename BoardTraits<BoxSize>::Mask;
+	using Grid = typename BoardTraits<BoxSize>::Grid;
+	using CellList = std::span<const typename IndexableBag<BOARD_CELLS>::Element>;
+
+	BasicBoard();
 	void GenerateNewSudoku();
-	void HideCells(int amountToHide);
+	// Builds a new sudoku in constant time by applying a random symmetry transform to an already solved grid
+	void GenerateNewSudoku(const Grid& seedSolution);
+	bool HideCells(int amountToHide);
+	// Replaces the board with a finished sudoku, cells left empty in givens are hidden
+	void LoadSudoku(const Grid& givens, const Grid& solution);
 	void ClearCellGuess(int index);
 	void EnterCellGuess(int index, int value);
 	bool IsSolutionCorrect() const;
 	bool IsCellHidden(int index) const;
 	bool IsCellEmpty(int index) const;
-	int CalcIndex(int row, int column) const;
-	int CalcRow(int index) const;
-	int CalcColumn(int index) const;
+	// True if the cell's guess is also shown elsewhere in its row, column or box
+	bool IsCellInConflict(int index) const;
+	// Values not shown anywhere in the cell's row, column or box, none if the cell is not empty
+	Mask GetCellCandidates(int index) const;
+	// Pencil marks are kept when a guess is entered, but only matter while the cell is empty, so toggles on a guessed cell are ignored
+	void TogglePencilMark(int index, int value);
+	void ClearPencilMarks(int index);
+	// Marks every empty hidden cell with its candidates, replacing what the player noted
+	void FillPencilMarks();
+	Mask GetPencilMarks(int index) const;
+	// The cell is highlighted until the next change to what the board shows
+	void SetHintedCell(int index);
+	// NO_HINTED_CELL if there is none
+	int GetHintedCellIndex() const;
+	// Cells are indexed box by box, e.g. on a 9x9 board indeces 0-8 are the top left box
+	// All of these are lookups in BOARD_TOPOLOGY, only debug builds check the arguments
+	static constexpr int CalcIndex(int row, int column);
+	static constexpr int CalcRow(int index);
+	static constexpr int CalcColumn(int index);
+	static constexpr int CalcBox(int index);
+	static constexpr int CalcBox(int row, int column);
+	// Position of the cell in a Grid, which is row-major
+	static constexpr int CalcGridIndex(int index);
 	int GetRandomIncorrectCellIndex() const;
 	int GetVisibleCellCount() const;
 	int GetIncorrectCellCount() const;
-	void Draw(sf::RenderWindow& rWindow, float cellSize, sf::Vector2f firstCellPos) const;
+	int GetConflictingCellCount() const;
+	// Indeces of all cells in conflict, in no particular order
+	CellList GetConflictingCells() const;
+	// Values of all cells, including hidden ones
+	Grid GetSolutionGrid() const;
+	// Values of cells that are not hidden, hidden cells are left empty
+	Grid GetGivenGrid() const;
+	// What the player sees, givens and guesses, empty cells are left empty
+	Grid GetGuessGrid() const;
+	// Changes whenever anything that is drawn changes, never repeats between boards so renderers can cache on it
+	std::uint32_t GetRevision() const;
 
 private:
-	static inline sf::Font ms_CellsFont;
-	std::vector<Cell> m_SudokuCells;
+	enum class Unit { ROW, COLUMN, BOX };
+	static constexpr auto UNIT_TYPES = 3;
+	static constexpr std::array<Unit, UNIT_TYPES> UNITS = { Unit::ROW, Unit::COLUMN, Unit::BOX };
+
+	static inline std::atomic<std::uint32_t> ms_LastRevision = 0;
+	std::array<BasicCell<BoxSize>, BOARD_CELLS> m_SudokuCells;
+	// Occupancy of each row/column/box, one bit per value
+	std::array<Mask, BOARD_SIZE> m_RowMasks;
+	std::array<Mask, BOARD_SIZE> m_ColumnMasks;
+	std::array<Mask, BOARD_SIZE> m_BoxMasks;
 	int m_HiddenCellCount;
 	int m_EmptyCellCount;
-	int m_CorrectCellCount;
+	// Empty cells and cells with a wrong guess, kept up to date on every guess
+	IndexableBag<BOARD_CELLS> m_IncorrectCells;
+	// How many cells show each value in each row/column/box, updated on every guess so conflicts never need a scan
+	std::array<std::array<std::array<std::uint8_t, BOARD_SIZE>, BOARD_SIZE>, UNIT_TYPES> m_GuessCounts;
+	// Values shown more than once in each row/column/box, one bit per value
+	std::array<std::array<Mask, BOARD_SIZE>, UNIT_TYPES> m_ConflictMasks;
+	IndexableBag<BOARD_CELLS> m_ConflictingCells;
+	// Values shown at least once in each row/column/box, the rest are the candidates of its empty cells
+	std::array<std::array<Mask, BOARD_SIZE>, UNIT_TYPES> m_ShownMasks;
+	int m_HintedCellIndex;
+	std::uint32_t m_Revision;
 
+	static constexpr void ValidateIndex(int index);
+	static constexpr void ValidateRowAndColumn(int row, int column);
+	static constexpr int CalcUnit(Unit unit, int index);
+	// Index of the cell at position within the given row/column/box
+	static constexpr int CalcUnitCellIndex(Unit unit, int unitIndex, int position);
+	void FillByBacktracking();
+	void FillBySolvingSeededBoxes();
+	void PlaceValue(int value, int index);
+	void RemoveValue(int index);
 	bool IsBoxValid(int value, int index) const;
 	bool IsRowValid(int value, int index) const;
 	bool IsColumnValid(int value, int index) const;
+	void RecountGuesses();
+	void AddGuessToUnits(int value, int index);
+	void RemoveGuessFromUnits(int value, int index);
+	// Rechecks the cells of a unit that show value after its count crossed between one and two
+	void UpdateUnitConflicts(Unit unit, int unitIndex, int value);
+	void UpdateCellConflict(int index);
+	void UpdateCellCorrectness(int index);
+	// Called once by every public function that changes the board, rather than per cell, since the counter is shared by all threads
+	void StampRevision();
 };
 
+// Index maths stays in the header so it is constant folded for every board size
+template<int BoxSize>
+constexpr int BasicBoard<BoxSize>::CalcIndex(int row, int column)
+{
+	ValidateRowAndColumn(row, column);
+	return BOARD_TOPOLOGY<BoxSize>.cellIndices[row * BOARD_SIZE + column];
+}
+
+template<int BoxSize>
+constexpr int BasicBoard<BoxSize>::CalcRow(int index)
+{
+	ValidateIndex(index);
+	return BOARD_TOPOLOGY<BoxSize>.rows[index];
+}
+
+template<int BoxSize>
+constexpr int BasicBoard<BoxSize>::CalcColumn(int index)
+{
+	ValidateIndex(index);
+	return BOARD_TOPOLOGY<BoxSize>.columns[index];
+}
+
+template<int BoxSize>
+constexpr int BasicBoard<BoxSize>::CalcBox(int index)
+{
+	ValidateIndex(index);
+	return BOARD_TOPOLOGY<BoxSize>.boxes[index];
+}
+
+template<int BoxSize>
+constexpr int BasicBoard<BoxSize>::CalcBox(int row, int column)
+{
+	return CalcBox(CalcIndex(row, column));
+}
+
+template<int BoxSize>
+constexpr int BasicBoard<BoxSize>::CalcGridIndex(int index)
+{
+	ValidateIndex(index);
+	return BOARD_TOPOLOGY<BoxSize>.gridIndices[index];
+}
+
+template<int BoxSize>
+constexpr int BasicBoard<BoxSize>::CalcUnit(Unit unit, int index)
+{
+	switch (unit)
+	{
+	case Unit::ROW: return CalcRow(index);
+	case Unit::COLUMN: return CalcColumn(index);
+	default: return CalcBox(index);
+	}
+}
+
+template<int BoxSize>
+constexpr int BasicBoard<BoxSize>::CalcUnitCellIndex(Unit unit, int unitIndex, int position)
+{
+	switch (unit)
+	{
+	case Unit::ROW: return CalcIndex(unitIndex, position);
+	case Unit::COLUMN: return CalcIndex(position, unitIndex);
+	// Cells are stored box by box
+	default: return unitIndex * BOARD_SIZE + position;
+	}
+}
+
+template<int BoxSize>
+constexpr void BasicBoard<BoxSize>::ValidateIndex([[maybe_unused]] int index)
+{
+#if !defined(NDEBUG)
+	if (!std::is_constant_evaluated()) { Assert(ERROR_CELL_OUT_OF_RANGE, index >= 0 && index < BOARD_CELLS); }
+#endif
+}
+
+template<int BoxSize>
+constexpr void BasicBoard<BoxSize>::ValidateRowAndColumn([[maybe_unused]] int row, [[maybe_unused]] int column)
+{
+#if !defined(NDEBUG)
+	if (!std::is_constant_evaluated())
+	{
+		Assert(ERROR_ROW_OUT_OF_RANGE, row >= 0 && row < BOARD_SIZE);
+		Assert(ERROR_COLUMN_OUT_OF_RANGE, column >= 0 && column < BOARD_SIZE);
+	}
+#endif
+}
+
+// Defined in Board.cpp for 4x4, 9x9, 16x16 and 25x25 boards
+extern template class BasicBoard<2>;
+extern template class BasicBoard<3>;
+extern template class BasicBoard<4>;
+extern template class BasicBoard<5>;
+
+using Board = BasicBoard<BOX_SIZE>;
+
 #endif
\ No newline at end of file
@@ -0,0 +1,154 @@
+#include "BoardRenderer.h"
+#include "TextPrinting.h"		// for GetFontPath()
+#include <cmath>				// for roundf()
+
+static constexpr auto CELL_FONT_FILENAME = "Opensticks";
+static constexpr auto CELL_TEXT_SIZE = 40u;
+static constexpr auto CELL_TEXT_BOLD = true;
+static inline const auto CELL_TEXT_COLOR_HIDDEN = sf::Color::White;
+static inline const auto CELL_TEXT_COLOR_NOT_HIDDEN = sf::Color(0, 0, 0, 200);
+static inline const auto CELL_TEXT_COLOR_CONFLICT = sf::Color(200, 30, 30);
+static constexpr auto PENCIL_MARK_TEXT_SIZE = 16u;
+static constexpr auto PENCIL_MARK_TEXT_BOLD = false;
+static inline const auto PENCIL_MARK_COLOR = sf::Color(255, 255, 255, 170);
+static inline const auto CELL_HINT_COLOR = sf::Color(255, 220, 60, 110);
+static inline const auto GRIDLINE_COLOR = sf::Color::Black;
+static constexpr auto GRIDLINE_THICKNESS = 1.0f;
+// Same padding sf::Text puts around each glyph, so numbers look as they did when drawn one sf::Text at a time
+static constexpr auto GLYPH_PADDING = 1.0f;
+static constexpr auto VERTICES_PER_QUAD = 4;
+static constexpr auto FIRST_DIGIT = '0';
+static_assert(BOARD_SIZE < 10, "Each value is drawn as a single digit glyph.");
+
+// Writes a quad textured with the glyph, centered the way PrintText() centers a single character
+static void SetGlyphQuad(sf::Vertex* pQuad, const sf::Glyph& glyph, sf::Vector2f center, sf::Color color)
+{
+	auto left = center.x - roundf(0.5f * glyph.bounds.width) - GLYPH_PADDING;
+	auto top = center.y - roundf(0.5f * glyph.bounds.height) - GLYPH_PADDING;
+	auto right = left + glyph.bounds.width + 2 * GLYPH_PADDING;
+	auto bottom = top + glyph.bounds.height + 2 * GLYPH_PADDING;
+	auto u1 = glyph.textureRect.left - GLYPH_PADDING;
+	auto v1 = glyph.textureRect.top - GLYPH_PADDING;
+	auto u2 = glyph.textureRect.left + glyph.textureRect.width + GLYPH_PADDING;
+	auto v2 = glyph.textureRect.top + glyph.textureRect.height + GLYPH_PADDING;
+
+	pQuad[0] = sf::Vertex(sf::Vector2f(left, top), color, sf::Vector2f(u1, v1));
+	pQuad[1] = sf::Vertex(sf::Vector2f(right, top), color, sf::Vector2f(u2, v1));
+	pQuad[2] = sf::Vertex(sf::Vector2f(right, bottom), color, sf::Vector2f(u2, v2));
+	pQuad[3] = sf::Vertex(sf::Vector2f(left, bottom), color, sf::Vector2f(u1, v2));
+}
+
+BoardRenderer::BoardRenderer() :
+	m_Shapes(sf::Quads),
+	m_Glyphs(sf::Quads),
+	m_PencilMarks(sf::Quads, BOARD_CELLS * BOARD_SIZE * VERTICES_PER_QUAD),
+	m_BuiltPencilMarks(),
+	m_BuiltRevision(),
+	m_BuiltCellSize(),
+	m_BuiltFirstCellPos()
+{
+}
+
+void BoardRenderer::Draw(sf::RenderWindow& rWindow, const Board& board, float cellSize, sf::Vector2f firstCellPos)
+{
+	// Load the font on first draw so constructing a renderer never touches the disk
+	if (!ms_CellsFontLoaded) { LoadFont(); }
+
+	auto layoutChanged = cellSize != m_BuiltCellSize || firstCellPos != m_BuiltFirstCellPos;
+	if (layoutChanged || board.GetRevision() != m_BuiltRevision)
+	{
+		Rebuild(board, cellSize, firstCellPos);
+		UpdatePencilMarks(board, layoutChanged);
+	}
+
+	rWindow.draw(m_Shapes);
+	rWindow.draw(m_PencilMarks, &ms_CellsFont.getTexture(PENCIL_MARK_TEXT_SIZE));
+	rWindow.draw(m_Glyphs, &ms_CellsFont.getTexture(CELL_TEXT_SIZE));
+}
+
+// Every digit is put on the glyph page up front, so the page never grows under quads that are already built
+void BoardRenderer::LoadFont()
+{
+	ms_CellsFontLoaded = ms_CellsFont.loadFromFile(GetFontPath(CELL_FONT_FILENAME));
+	for (auto value = 1; value <= BOARD_SIZE; value++)
+	{
+		ms_CellsFont.getGlyph(FIRST_DIGIT + value, CELL_TEXT_SIZE, CELL_TEXT_BOLD);
+		ms_CellsFont.getGlyph(FIRST_DIGIT + value, PENCIL_MARK_TEXT_SIZE, PENCIL_MARK_TEXT_BOLD);
+	}
+}
+
+void BoardRenderer::Rebuild(const Board& board, float cellSize, sf::Vector2f firstCellPos)
+{
+	m_BuiltRevision = board.GetRevision();
+	m_BuiltCellSize = cellSize;
+	m_BuiltFirstCellPos = firstCellPos;
+	m_Shapes.clear();
+	m_Glyphs.clear();
+
+	// Hint highlight, under the number
+	auto hintedCell = board.GetHintedCellIndex();
+	if (hintedCell != NO_HINTED_CELL)
+	{
+		auto position = sf::Vector2f(firstCellPos.x + (Board::CalcColumn(hintedCell) - 0.5f) * cellSize, firstCellPos.y + (Board::CalcRow(hintedCell) - 0.5f) * cellSize);
+		AddRectangle(position, sf::Vector2f(cellSize, cellSize), CELL_HINT_COLOR);
+	}
+
+	// Gridlines between boxes
+	for (auto line = BOX_SIZE; line < BOARD_SIZE; line += BOX_SIZE)
+	{
+		AddRectangle(sf::Vector2f(firstCellPos.x - cellSize * 0.5f, firstCellPos.y + cellSize * (line - 0.5f)), sf::Vector2f(BOARD_SIZE * cellSize, GRIDLINE_THICKNESS), GRIDLINE_COLOR);
+		AddRectangle(sf::Vector2f(firstCellPos.x + cellSize * (line - 0.5f), firstCellPos.y - cellSize * 0.5f), sf::Vector2f(GRIDLINE_THICKNESS, BOARD_SIZE * cellSize), GRIDLINE_COLOR);
+	}
+
+	// Numbers
+	auto guesses = board.GetGuessGrid();
+	for (auto index = 0; index < BOARD_CELLS; index++)
+	{
+		if (board.IsCellEmpty(index)) { continue; }
+
+		sf::Color color;
+		if (board.IsCellInConflict(index)) { color = CELL_TEXT_COLOR_CONFLICT; }
+		else { color = (board.IsCellHidden(index)) ? CELL_TEXT_COLOR_HIDDEN : CELL_TEXT_COLOR_NOT_HIDDEN; }
+		auto center = sf::Vector2f(roundf(firstCellPos.x + Board::CalcColumn(index) * cellSize), roundf(firstCellPos.y + Board::CalcRow(index) * cellSize));
+		AddGlyph(guesses[Board::CalcGridIndex(index)], center, color);
+	}
+}
+
+// Each value has its own spot in the cell, laid out like the values of a box
+void BoardRenderer::UpdatePencilMarks(const Board& board, bool layoutChanged)
+{
+	auto markSize = m_BuiltCellSize / BOX_SIZE;
+	for (auto index = 0; index < BOARD_CELLS; index++)
+	{
+		auto marks = board.IsCellEmpty(index) ? board.GetPencilMarks(index) : NO_CANDIDATES;
+		if (marks == m_BuiltPencilMarks[index] && !layoutChanged) { continue; }
+		m_BuiltPencilMarks[index] = marks;
+
+		auto cellCenter = sf::Vector2f(m_BuiltFirstCellPos.x + Board::CalcColumn(index) * m_BuiltCellSize, m_BuiltFirstCellPos.y + Board::CalcRow(index) * m_BuiltCellSize);
+		for (auto value = 1; value <= BOARD_SIZE; value++)
+		{
+			auto* pQuad = &m_PencilMarks[(index * BOARD_SIZE + value - 1) * VERTICES_PER_QUAD];
+			auto center = sf::Vector2f(roundf(cellCenter.x + ((value - 1) % BOX_SIZE - 0.5f * (BOX_SIZE - 1)) * markSize),
+				roundf(cellCenter.y + ((value - 1) / BOX_SIZE - 0.5f * (BOX_SIZE - 1)) * markSize));
+
+			// Unmarked values keep their quad, collapsed to nothing
+			if (marks & GetCandidateBit(value)) { SetGlyphQuad(pQuad, ms_CellsFont.getGlyph(FIRST_DIGIT + value, PENCIL_MARK_TEXT_SIZE, PENCIL_MARK_TEXT_BOLD), center, PENCIL_MARK_COLOR); }
+			else { for (auto vertex = 0; vertex < VERTICES_PER_QUAD; vertex++) { pQuad[vertex] = sf::Vertex(center); } }
+		}
+	}
+}
+
+void BoardRenderer::AddRectangle(sf::Vector2f position, sf::Vector2f size, sf::Color color)
+{
+	m_Shapes.append(sf::Vertex(position, color));
+	m_Shapes.append(sf::Vertex(sf::Vector2f(position.x + size.x, position.y), color));
+	m_Shapes.append(sf::Vertex(position + size, color));
+	m_Shapes.append(sf::Vertex(sf::Vector2f(position.x, position.y + size.y), color));
+}
+
+void BoardRenderer::AddGlyph(int value, sf::Vector2f center, sf::Color color)
+{
+	auto first = m_Glyphs.getVertexCount();
+	m_Glyphs.resize(first + VERTICES_PER_QUAD);
+	SetGlyphQuad(&m_Glyphs[first], ms_CellsFont.getGlyph(FIRST_DIGIT + value, CELL_TEXT_SIZE, CELL_TEXT_BOLD), center, color);
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+#pragma once
+#ifndef BOARD_RENDERER_H
+#define BOARD_RENDERER_H
+
+#include "Board.h"			// also includes "Board_info.h"
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <array>
+
+// Draws a board in three draw calls: the hint highlight and gridlines as plain quads, then the pencil marks and
+// every number as quads textured from the font's glyph pages
+// The vertex arrays are kept between frames and only rebuilt when the board's revision or the layout changes
+// Pencil marks have a fixed quad per cell and value, only the quads of cells whose marks changed are rewritten
+class BoardRenderer
+{
+public:
+	BoardRenderer();
+	void Draw(sf::RenderWindow& rWindow, const Board& board, float cellSize, sf::Vector2f firstCellPos);
+
+private:
+	static inline sf::Font ms_CellsFont;
+	static inline bool ms_CellsFontLoaded = false;
+	sf::VertexArray m_Shapes;
+	sf::VertexArray m_Glyphs;
+	sf::VertexArray m_PencilMarks;
+	// Marks as last written to m_PencilMarks, none for cells that show a number
+	std::array<Board::Mask, BOARD_CELLS> m_BuiltPencilMarks;
+	std::uint32_t m_BuiltRevision;
+	float m_BuiltCellSize;
+	sf::Vector2f m_BuiltFirstCellPos;
+
+	static void LoadFont();
+	void Rebuild(const Board& board, float cellSize, sf::Vector2f firstCellPos);
+	void UpdatePencilMarks(const Board& board, bool layoutChanged);
+	void AddRectangle(sf::Vector2f position, sf::Vector2f size, sf::Color color);
+	// Centered on center, the way PrintText() centers a single character
+	void AddGlyph(int value, sf::Vector2f center, sf::Color color);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,125 @@
+#pragma once
+#ifndef BOARD_TOPOLOGY_H
+#define BOARD_TOPOLOGY_H
+
+#include "Board_info.h"		// for BoardTraits
+#include <array>
+#include <cstdint>
+
+// Lookup tables for the cell index maths of a board and the cell groups of the grader, built at compile time from BoxSize
+// Cells are indexed box by box as on Board, grid positions row by row as on Grid
+template<int BoxSize>
+struct BoardTopology
+{
+	static constexpr auto BOX_SIZE = BoardTraits<BoxSize>::BOX_SIZE;
+	static constexpr auto BOARD_SIZE = BoardTraits<BoxSize>::BOARD_SIZE;
+	static constexpr auto BOARD_CELLS = BoardTraits<BoxSize>::BOARD_CELLS;
+	// Rows, then columns, then boxes
+	static constexpr auto UNIT_COUNT = 3 * BOARD_SIZE;
+	// Other cells sharing a row, column or box with a cell
+	static constexpr auto PEER_COUNT = 2 * (BOARD_SIZE - 1) + (BOX_SIZE - 1) * (BOX_SIZE - 1);
+	// Each box with each row and column crossing it
+	static constexpr auto INTERSECTION_COUNT = 2 * BOARD_SIZE * BOX_SIZE;
+	static constexpr auto INTERSECTION_REST = BOARD_SIZE - BOX_SIZE;
+	using CellIndex = std::uint16_t;
+
+	std::array<std::uint8_t, BOARD_CELLS> rows;
+	std::array<std::uint8_t, BOARD_CELLS> columns;
+	std::array<std::uint8_t, BOARD_CELLS> boxes;
+	// Cell -> grid position
+	std::array<CellIndex, BOARD_CELLS> gridIndices;
+	// Grid position -> cell
+	std::array<CellIndex, BOARD_CELLS> cellIndices;
+	// The rest are grid positions
+	std::array<std::array<CellIndex, BOARD_SIZE>, UNIT_COUNT> units;
+	// By grid position, the rest of the row and column outside the box, then the rest of the box
+	std::array<std::array<CellIndex, PEER_COUNT>, BOARD_CELLS> peers;
+	// Box by box, crossed by its rows then its columns: the shared cells, the rest of the box and the rest of the line
+	std::array<std::array<CellIndex, BOX_SIZE>, INTERSECTION_COUNT> intersections;
+	std::array<std::array<CellIndex, INTERSECTION_REST>, INTERSECTION_COUNT> intersectionBoxRests;
+	std::array<std::array<CellIndex, INTERSECTION_REST>, INTERSECTION_COUNT> intersectionLineRests;
+};
+
+template<int BoxSize>
+constexpr BoardTopology<BoxSize> MakeBoardTopology()
+{
+	using Topology = BoardTopology<BoxSize>;
+	using CellIndex = typename Topology::CellIndex;
+	constexpr auto BOX_SIZE = Topology::BOX_SIZE;
+	constexpr auto BOARD_SIZE = Topology::BOARD_SIZE;
+	Topology topology{};
+
+	for (auto row = 0; row < BOARD_SIZE; row++)
+	{
+		for (auto column = 0; column < BOARD_SIZE; column++)
+		{
+			auto box = (row / BOX_SIZE) * BOX_SIZE + column / BOX_SIZE;
+			auto index = box * BOARD_SIZE + (row % BOX_SIZE) * BOX_SIZE + column % BOX_SIZE;
+			auto gridIndex = row * BOARD_SIZE + column;
+			topology.rows[index] = static_cast<std::uint8_t>(row);
+			topology.columns[index] = static_cast<std::uint8_t>(column);
+			topology.boxes[index] = static_cast<std::uint8_t>(box);
+			topology.gridIndices[index] = static_cast<CellIndex>(gridIndex);
+			topology.cellIndices[gridIndex] = static_cast<CellIndex>(index);
+		}
+	}
+
+	// A box's cells are consecutive cell indices, in row order within the box
+	for (auto unit = 0; unit < BOARD_SIZE; unit++)
+	{
+		for (auto i = 0; i < BOARD_SIZE; i++)
+		{
+			topology.units[unit][i] = static_cast<CellIndex>(unit * BOARD_SIZE + i);
+			topology.units[BOARD_SIZE + unit][i] = static_cast<CellIndex>(i * BOARD_SIZE + unit);
+			topology.units[2 * BOARD_SIZE + unit][i] = topology.gridIndices[unit * BOARD_SIZE + i];
+		}
+	}
+
+	for (auto gridIndex = 0; gridIndex < Topology::BOARD_CELLS; gridIndex++)
+	{
+		auto row = gridIndex / BOARD_SIZE;
+		auto column = gridIndex % BOARD_SIZE;
+		auto box = topology.boxes[topology.cellIndices[gridIndex]];
+		auto count = 0;
+
+		for (auto i = 0; i < BOARD_SIZE; i++)
+		{
+			auto rowPeer = row * BOARD_SIZE + i;
+			if (topology.boxes[topology.cellIndices[rowPeer]] != box) { topology.peers[gridIndex][count++] = static_cast<CellIndex>(rowPeer); }
+			auto columnPeer = i * BOARD_SIZE + column;
+			if (topology.boxes[topology.cellIndices[columnPeer]] != box) { topology.peers[gridIndex][count++] = static_cast<CellIndex>(columnPeer); }
+		}
+		for (auto boxPeer : topology.units[2 * BOARD_SIZE + box])
+			if (boxPeer != gridIndex) { topology.peers[gridIndex][count++] = boxPeer; }
+	}
+
+	auto intersection = 0;
+	for (auto box = 0; box < BOARD_SIZE; box++)
+	{
+		for (auto isColumn = 0; isColumn < 2; isColumn++)
+		{
+			for (auto offset = 0; offset < BOX_SIZE; offset++, intersection++)
+			{
+				auto line = isColumn ? (box % BOX_SIZE) * BOX_SIZE + offset : (box / BOX_SIZE) * BOX_SIZE + offset;
+				const auto& lineCells = topology.units[isColumn * BOARD_SIZE + line];
+				const auto& boxCells = topology.units[2 * BOARD_SIZE + box];
+				auto shared = 0, boxRest = 0, lineRest = 0;
+
+				for (auto i = 0; i < BOARD_SIZE; i++)
+				{
+					auto inLine = (isColumn ? boxCells[i] % BOARD_SIZE : boxCells[i] / BOARD_SIZE) == line;
+					if (inLine) { topology.intersections[intersection][shared++] = boxCells[i]; }
+					else { topology.intersectionBoxRests[intersection][boxRest++] = boxCells[i]; }
+					if (topology.boxes[topology.cellIndices[lineCells[i]]] != box) { topology.intersectionLineRests[intersection][lineRest++] = lineCells[i]; }
+				}
+			}
+		}
+	}
+
+	return topology;
+}
+
+template<int BoxSize>
+inline constexpr auto BOARD_TOPOLOGY = MakeBoardTopology<BoxSize>();
+
+#endif
\ No newline at end of file
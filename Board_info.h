@@ -0,0 +1,32 @@
+#pragma once
+#ifndef BOARD_INFO
+#define BOARD_INFO
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+// Sizes and types of a board made of BoxSize x BoxSize boxes
+template<int BoxSize>
+struct BoardTraits
+{
+	static_assert(BoxSize >= 2 && BoxSize <= 5, "Only 4x4, 9x9, 16x16 and 25x25 boards are supported.");
+	static constexpr auto BOX_SIZE = BoxSize;
+	static constexpr auto BOARD_SIZE = BOX_SIZE * BOX_SIZE;
+	static constexpr auto BOARD_CELLS = BOARD_SIZE * BOARD_SIZE;
+	// One bit per value, 16 bits are enough up to 16x16 boards
+	using Mask = std::conditional_t<(BOARD_SIZE <= 16), std::uint16_t, std::uint32_t>;
+	static constexpr auto ALL_CANDIDATES = static_cast<Mask>((1ull << BOARD_SIZE) - 1);
+	// Raw grid in row-major order (row * BOARD_SIZE + column), EMPTY_CELL_VALUE for cells with no value
+	using Grid = std::array<std::uint8_t, BOARD_CELLS>;
+};
+
+// Default board used by the game
+static constexpr auto BOX_SIZE = 3;
+static constexpr auto BOARD_SIZE = BoardTraits<BOX_SIZE>::BOARD_SIZE;
+static constexpr auto BOARD_CELLS = BoardTraits<BOX_SIZE>::BOARD_CELLS;
+static constexpr auto EMPTY_CELL_VALUE = 0;
+
+using SudokuGrid = BoardTraits<BOX_SIZE>::Grid;
+
+#endif
\ No newline at end of file
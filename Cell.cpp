@@ -1,77 +1,132 @@
 #include "Cell.h"
-#include "Random.h"			// for TakeRandomElementFromSet()
+#include "Random.h"			// for GetRandomNumberBetween()
 #include "ErrorLogging.h"	// for Assert()
+#include <bit>				// for popcount() and countr_zero()
 
-#define INIT_SET {1,2,3,4,5,6,7,8,9}
 static constexpr auto CLEAR_CELL_VALUE = 0;
 static constexpr auto ERROR_HIDE_BEFORE_VALUE_SET = "Cell has no value yet - must have value in order to hide.";
 
-Cell::Cell()
+template<int BoxSize>
+BasicCell<BoxSize>::BasicCell()
 {
 	Reset();
 }
 
-void Cell::ClearGuess()
+template<int BoxSize>
+void BasicCell<BoxSize>::ClearGuess()
 {
 	m_Guess = CLEAR_CELL_VALUE;
 }
 
-void Cell::Hide()
+// Keeps the remaining candidates so backtracking can try the next one
+template<int BoxSize>
+void BasicCell<BoxSize>::ClearValue()
+{
+	m_Value = CLEAR_CELL_VALUE;
+	m_Guess = CLEAR_CELL_VALUE;
+}
+
+template<int BoxSize>
+void BasicCell<BoxSize>::Hide()
 {
 	Assert(ERROR_HIDE_BEFORE_VALUE_SET, m_Value != CLEAR_CELL_VALUE);
 	ClearGuess();
+	m_PencilMarks = NO_CANDIDATES;
 	m_Hidden = true;
 }
 
-void Cell::Reset()
+template<int BoxSize>
+void BasicCell<BoxSize>::Reset()
 {
-	m_Candidates = INIT_SET;
+	m_Candidates = BoardTraits<BoxSize>::ALL_CANDIDATES;
+	m_PencilMarks = NO_CANDIDATES;
 	m_Value = CLEAR_CELL_VALUE;
+	m_Guess = CLEAR_CELL_VALUE;
 	m_Hidden = false;
 }
 
-void Cell::SetValue(int value)
+template<int BoxSize>
+void BasicCell<BoxSize>::SetValue(int value)
+{
+	m_Value = static_cast<std::uint8_t>(value);
+	m_Guess = static_cast<std::uint8_t>(value);
+}
+
+template<int BoxSize>
+void BasicCell<BoxSize>::SetGuess(int value)
 {
-	m_Value = value;
-	m_Guess = value;
+	m_Guess = static_cast<std::uint8_t>(value);
 }
 
-void Cell::SetGuess(int value)
+template<int BoxSize>
+void BasicCell<BoxSize>::TogglePencilMark(int value)
 {
-	m_Guess = value;
+	m_PencilMarks ^= GetCandidateBit<Mask>(value);
 }
 
-int Cell::GetValue() const
+template<int BoxSize>
+void BasicCell<BoxSize>::SetPencilMarks(Mask pencilMarks)
+{
+	m_PencilMarks = pencilMarks;
+}
+
+template<int BoxSize>
+int BasicCell<BoxSize>::GetValue() const
 {
 	return m_Value;
 }
 
-int Cell::GetGuess() const
+template<int BoxSize>
+int BasicCell<BoxSize>::GetGuess() const
 {
 	return m_Guess;
 }
 
-int Cell::GetRandomAvailableCandidate()
+template<int BoxSize>
+typename BasicCell<BoxSize>::Mask BasicCell<BoxSize>::GetPencilMarks() const
 {
-	return TakeRandomElementFromSet(m_Candidates);
+	return m_PencilMarks;
 }
 
-bool Cell::IsGuessCorrect() const
+template<int BoxSize>
+int BasicCell<BoxSize>::GetRandomAvailableCandidate()
+{
+	// Skip a random amount of remaining candidate bits
+	auto remaining = m_Candidates;
+	for (auto skip = GetRandomNumberBetween(0, std::popcount(m_Candidates) - 1, RandomStream::BOARD); skip > 0; skip--)
+		remaining &= remaining - 1;
+
+	// Take the lowest bit left and remove it from the candidates
+	auto bit = static_cast<Mask>(remaining & (~remaining + 1));
+	m_Candidates &= ~bit;
+	return std::countr_zero(bit) + 1;
+}
+
+template<int BoxSize>
+bool BasicCell<BoxSize>::IsGuessCorrect() const
 {
 	return m_Value == m_Guess;
 }
 
-bool Cell::IsGuessClear() const
+template<int BoxSize>
+bool BasicCell<BoxSize>::IsGuessClear() const
 {
 	return m_Guess == CLEAR_CELL_VALUE;
 }
 
-bool Cell::IsHidden() const
+template<int BoxSize>
+bool BasicCell<BoxSize>::IsHidden() const
 {
 	return m_Hidden;
 }
 
-bool Cell::RanOutOfCandidates() const
+template<int BoxSize>
+bool BasicCell<BoxSize>::RanOutOfCandidates() const
 {
-	return static_cast<int>(m_Candidates.size()) == 0;
-}
\ No newline at end of file
+	return m_Candidates == 0;
+}
+
+template class BasicCell<2>;
+template class BasicCell<3>;
+template class BasicCell<4>;
+template class BasicCell<5>;
\ No newline at end of file
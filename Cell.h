@@ -2,19 +2,38 @@
 #ifndef CELL_H
 #define CELL_H
 
-#include <set>
+#include "Board_info.h"		// for BoardTraits and BOX_SIZE
 
-class Cell
+// Candidate value v is stored in bit (v - 1)
+using CandidateMask = BoardTraits<BOX_SIZE>::Mask;
+static constexpr CandidateMask NO_CANDIDATES = 0;
+static constexpr CandidateMask ALL_CANDIDATES = BoardTraits<BOX_SIZE>::ALL_CANDIDATES;
+
+template<typename Mask = CandidateMask>
+constexpr Mask GetCandidateBit(int value)
+{
+	return static_cast<Mask>(Mask(1) << (value - 1));
+}
+
+template<int BoxSize>
+class BasicCell
 {
 public:
-	Cell();
+	using Mask = typename BoardTraits<BoxSize>::Mask;
+
+	BasicCell();
 	void ClearGuess();
+	void ClearValue();
 	void Hide();
 	void Reset();
 	void SetValue(int value);
 	void SetGuess(int value);
+	void TogglePencilMark(int value);
+	void SetPencilMarks(Mask pencilMarks);
 	int GetValue() const;
 	int GetGuess() const;
+	// Values the player noted as possible for the cell, one bit per value
+	Mask GetPencilMarks() const;
 	int GetRandomAvailableCandidate();
 	bool IsGuessCorrect() const;
 	bool IsGuessClear() const;
@@ -22,10 +41,19 @@ public:
 	bool RanOutOfCandidates() const;
 
 private:
-	std::set<int> m_Candidates;
-	int m_Value;
-	int m_Guess;
+	Mask m_Candidates;
+	Mask m_PencilMarks;
+	std::uint8_t m_Value;
+	std::uint8_t m_Guess;
 	bool m_Hidden;
 };
 
+// Defined in Cell.cpp for 4x4, 9x9, 16x16 and 25x25 boards
+extern template class BasicCell<2>;
+extern template class BasicCell<3>;
+extern template class BasicCell<4>;
+extern template class BasicCell<5>;
+
+using Cell = BasicCell<BOX_SIZE>;
+
 #endif
\ No newline at end of file
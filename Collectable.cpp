@@ -31,9 +31,9 @@ void Collectable::Update(float dtAsSeconds)
 	}
 }
 
-void Collectable::Draw(sf::RenderWindow& rWindow) const
+void Collectable::Draw(RenderQueue& rQueue, DrawOrder order) const
 {
-	if (!(IsCollected() || IsDespawned())) { Object::Draw(rWindow); }
+	if (!(IsCollected() || IsDespawned())) { Object::Draw(rQueue, order); }
 }
 
 Collectable::Collectable(float despawnTime) :
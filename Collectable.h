@@ -13,7 +13,7 @@ public:
 	virtual ~Collectable() noexcept = default;
 	virtual void Collect() = 0;
 	virtual void Update(float dtAsSeconds) override;
-	virtual void Draw(sf::RenderWindow& rWindow) const final override;
+	virtual void Draw(RenderQueue& rQueue, DrawOrder order) const final override;
 
 protected:
 	Collectable(float despawnTime);
@@ -53,7 +53,7 @@ static void CollisionWallsVs(Movable& movable)
 	if (auto* pProj = dynamic_cast<Projectile*>(&movable))
 	{
 		// Adjust all wall offsets
-		topWallOffset -= GetRandomNumberBetween(PROJECTILE_OFFSET_TOP_WALL_MIN, PROJECTILE_OFFSET_TOP_WALL_MAX);
+		topWallOffset -= GetRandomNumberBetween(PROJECTILE_OFFSET_TOP_WALL_MIN, PROJECTILE_OFFSET_TOP_WALL_MAX, RandomStream::COLLISIONS);
 		bottomWallOffset += PROJECTILE_OFFSET_BOTTOM_WALL;
 		leftWallOffset -= PROJECTILE_OFFSET_LEFT_RIGHT_WALL;
 		rightWallOffset += PROJECTILE_OFFSET_LEFT_RIGHT_WALL;
@@ -25,6 +25,44 @@ std::string GetDifficultyString(int difficulty)
 	}
 }
 
+Technique GetMinTechnique(int difficulty)
+{
+	switch (difficulty)
+	{
+	case 0:
+	case 1:
+		return Technique::NAKED_SINGLE;
+		break;
+	case 2:
+		return Technique::HIDDEN_SINGLE;
+		break;
+	default:
+		Assert(ERROR_DIFFICULTY_OUT_OF_RANGE);
+		return Technique::NONE;
+		break;
+	}
+}
+
+Technique GetMaxTechnique(int difficulty)
+{
+	switch (difficulty)
+	{
+	case 0:
+		return Technique::NAKED_SINGLE;
+		break;
+	case 1:
+		return Technique::HIDDEN_SINGLE;
+		break;
+	case 2:
+		return Technique::X_WING;
+		break;
+	default:
+		Assert(ERROR_DIFFICULTY_OUT_OF_RANGE);
+		return Technique::NONE;
+		break;
+	}
+}
+
 int GetDefaultDifficulty()
 {
 	return DEFAULT_DIFFICULTY;
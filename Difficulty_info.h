@@ -2,10 +2,14 @@
 #ifndef DIFFICULTY_INFO
 #define DIFFICULTY_INFO
 
+#include "Technique.h"
 #include <string>
 
 // Returns the difficulty as a string
 std::string GetDifficultyString(int difficulty);
+// Generated sudokus should need at least the min technique and no more than the max technique to solve
+Technique GetMinTechnique(int difficulty);
+Technique GetMaxTechnique(int difficulty);
 int GetDefaultDifficulty();
 int GetNumberOfDifficulties();
 void ValidateDifficulty(int difficulty);
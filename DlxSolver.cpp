@@ -0,0 +1,279 @@
+#include "DlxSolver.h"
+#include "ErrorLogging.h"	// for Assert()
+
+static constexpr auto ROOT_NODE = 0;
+static constexpr auto ERROR_GRID_VALUE_OUT_OF_RANGE = "Grid value is out of range - value must be between 0 and BOARD_SIZE.";
+
+template<int BoxSize>
+BasicDlxSolver<BoxSize>::BasicDlxSolver() :
+	m_ChosenCount(),
+	m_SolutionCount(),
+	m_SolutionLimit(),
+	m_StepsLeft(),
+	mp_Puzzle(nullptr),
+	mp_Visitor(nullptr),
+	mp_FirstSolution(nullptr),
+	m_Stopped()
+{
+	// Constraint columns are laid out cells first, then rows, then columns, then boxes
+	constexpr auto CELL_CONSTRAINTS_START = 1;
+	constexpr auto ROW_CONSTRAINTS_START = CELL_CONSTRAINTS_START + BOARD_CELLS;
+	constexpr auto COLUMN_CONSTRAINTS_START = ROW_CONSTRAINTS_START + BOARD_CELLS;
+	constexpr auto BOX_CONSTRAINTS_START = COLUMN_CONSTRAINTS_START + BOARD_CELLS;
+
+	// Link root and column headers in a circular list, each header starts as an empty vertical list
+	for (auto column = 0; column <= COLUMN_COUNT; column++)
+	{
+		m_Left[column] = static_cast<Link>(column == 0 ? COLUMN_COUNT : column - 1);
+		m_Right[column] = static_cast<Link>(column == COLUMN_COUNT ? 0 : column + 1);
+		m_Up[column] = m_Down[column] = m_Column[column] = static_cast<Link>(column);
+		m_Row[column] = -1;
+		m_ColumnSize[column] = 0;
+		m_ColumnCovered[column] = false;
+	}
+
+	// Add one row of four nodes for every value in every cell
+	auto node = COLUMN_COUNT + 1;
+	for (auto cell = 0; cell < BOARD_CELLS; cell++)
+	{
+		auto row = cell / BOARD_SIZE;
+		auto column = cell % BOARD_SIZE;
+		auto box = (row / BOX_SIZE) * BOX_SIZE + (column / BOX_SIZE);
+
+		for (auto digit = 0; digit < BOARD_SIZE; digit++)
+		{
+			auto rowID = cell * BOARD_SIZE + digit;
+			const int columns[CONSTRAINTS_PER_CELL] =
+			{
+				CELL_CONSTRAINTS_START + cell,
+				ROW_CONSTRAINTS_START + row * BOARD_SIZE + digit,
+				COLUMN_CONSTRAINTS_START + column * BOARD_SIZE + digit,
+				BOX_CONSTRAINTS_START + box * BOARD_SIZE + digit
+			};
+			m_RowFirstNode[rowID] = static_cast<Link>(node);
+
+			for (auto i = 0; i < CONSTRAINTS_PER_CELL; i++, node++)
+			{
+				auto header = columns[i];
+				// Append to the bottom of the column
+				m_Column[node] = static_cast<Link>(header);
+				m_Row[node] = static_cast<Link>(rowID);
+				m_Up[node] = m_Up[header];
+				m_Down[node] = static_cast<Link>(header);
+				m_Down[m_Up[header]] = static_cast<Link>(node);
+				m_Up[header] = static_cast<Link>(node);
+				m_ColumnSize[header]++;
+				// Link horizontally with the rest of the row
+				auto first = m_RowFirstNode[rowID];
+				m_Left[node] = static_cast<Link>(i == 0 ? node : node - 1);
+				m_Right[node] = first;
+				m_Right[m_Left[node]] = static_cast<Link>(node);
+				m_Left[first] = static_cast<Link>(node);
+			}
+		}
+	}
+}
+
+template<int BoxSize>
+bool BasicDlxSolver<BoxSize>::Solve(const Grid& puzzle, Grid& rSolution)
+{
+	return Run(puzzle, 1, nullptr, &rSolution) > 0;
+}
+
+template<int BoxSize>
+bool BasicDlxSolver<BoxSize>::Solve(const Grid& puzzle, Grid& rSolution, int stepLimit)
+{
+	return Run(puzzle, 1, nullptr, &rSolution, stepLimit) > 0;
+}
+
+template<int BoxSize>
+int BasicDlxSolver<BoxSize>::CountSolutions(const Grid& puzzle, int limit)
+{
+	return Run(puzzle, limit, nullptr, nullptr);
+}
+
+template<int BoxSize>
+int BasicDlxSolver<BoxSize>::EnumerateSolutions(const Grid& puzzle, const SolutionVisitor& visitor, int limit)
+{
+	return Run(puzzle, limit, &visitor, nullptr);
+}
+
+template<int BoxSize>
+int BasicDlxSolver<BoxSize>::EnumerateSolutions(const BasicBoard<BoxSize>& board, const SolutionVisitor& visitor, int limit)
+{
+	return EnumerateSolutions(board.GetGivenGrid(), visitor, limit);
+}
+
+template<int BoxSize>
+int BasicDlxSolver<BoxSize>::Run(const Grid& puzzle, int limit, const SolutionVisitor* pVisitor, Grid* pFirstSolution, int stepLimit)
+{
+	m_ChosenCount = 0;
+	m_SolutionCount = 0;
+	m_SolutionLimit = limit;
+	m_StepsLeft = stepLimit;
+	mp_Puzzle = &puzzle;
+	mp_Visitor = pVisitor;
+	mp_FirstSolution = pFirstSolution;
+	m_Stopped = limit <= 0;
+
+	// Remove the given values from the matrix, a given clashing with an earlier one means no solution
+	std::array<Link, BOARD_CELLS> givenRows;
+	auto givenCount = 0;
+	for (auto cell = 0; cell < BOARD_CELLS && !m_Stopped; cell++)
+	{
+		auto value = static_cast<int>(puzzle[cell]);
+		if (value == EMPTY_CELL_VALUE) { continue; }
+		if (value > BOARD_SIZE)
+		{
+			Assert(ERROR_GRID_VALUE_OUT_OF_RANGE);
+			m_Stopped = true;
+			break;
+		}
+
+		auto node = m_RowFirstNode[cell * BOARD_SIZE + value - 1];
+		auto j = node;
+		do
+		{
+			if (m_ColumnCovered[m_Column[j]]) { m_Stopped = true; }
+			j = m_Right[j];
+		}
+		while (j != node);
+
+		if (!m_Stopped)
+		{
+			Cover(m_Column[node]);
+			CoverRow(node);
+			givenRows[givenCount++] = node;
+		}
+	}
+
+	if (!m_Stopped) { Search(); }
+
+	// Restore the matrix for the next search, in the reverse order it was covered
+	while (givenCount > 0)
+	{
+		auto node = givenRows[--givenCount];
+		UncoverRow(node);
+		Uncover(m_Column[node]);
+	}
+
+	mp_Puzzle = nullptr;
+	mp_Visitor = nullptr;
+	mp_FirstSolution = nullptr;
+	return m_SolutionCount;
+}
+
+template<int BoxSize>
+void BasicDlxSolver<BoxSize>::Search()
+{
+	// Out of search steps ?
+	if (--m_StepsLeft < 0)
+	{
+		m_Stopped = true;
+		return;
+	}
+
+	// All constraints satisfied ?
+	if (m_Right[ROOT_NODE] == ROOT_NODE)
+	{
+		RecordSolution();
+		return;
+	}
+
+	// Branch on the column with the fewest remaining candidates
+	auto column = static_cast<int>(m_Right[ROOT_NODE]);
+	for (auto c = static_cast<int>(m_Right[column]); c != ROOT_NODE && m_ColumnSize[column] > 1; c = m_Right[c])
+		if (m_ColumnSize[c] < m_ColumnSize[column]) { column = c; }
+
+	// Dead end ?
+	if (m_ColumnSize[column] == 0) { return; }
+
+	Cover(column);
+	for (auto node = static_cast<int>(m_Down[column]); node != column && !m_Stopped; node = m_Down[node])
+	{
+		m_ChosenRows[m_ChosenCount++] = static_cast<Link>(node);
+		CoverRow(node);
+		Search();
+		UncoverRow(node);
+		m_ChosenCount--;
+	}
+	Uncover(column);
+}
+
+template<int BoxSize>
+void BasicDlxSolver<BoxSize>::RecordSolution()
+{
+	m_SolutionCount++;
+
+	// Only build the grid when someone needs it
+	if (mp_Visitor != nullptr || (mp_FirstSolution != nullptr && m_SolutionCount == 1))
+	{
+		auto grid = *mp_Puzzle;
+		for (auto i = 0; i < m_ChosenCount; i++)
+		{
+			auto rowID = m_Row[m_ChosenRows[i]];
+			grid[rowID / BOARD_SIZE] = static_cast<std::uint8_t>(rowID % BOARD_SIZE + 1);
+		}
+
+		if (mp_FirstSolution != nullptr && m_SolutionCount == 1) { *mp_FirstSolution = grid; }
+		if (mp_Visitor != nullptr && !(*mp_Visitor)(grid)) { m_Stopped = true; }
+	}
+
+	if (m_SolutionCount >= m_SolutionLimit) { m_Stopped = true; }
+}
+
+template<int BoxSize>
+void BasicDlxSolver<BoxSize>::Cover(int column)
+{
+	m_ColumnCovered[column] = true;
+	m_Right[m_Left[column]] = m_Right[column];
+	m_Left[m_Right[column]] = m_Left[column];
+
+	for (auto i = static_cast<int>(m_Down[column]); i != column; i = m_Down[i])
+	{
+		for (auto j = static_cast<int>(m_Right[i]); j != i; j = m_Right[j])
+		{
+			m_Down[m_Up[j]] = m_Down[j];
+			m_Up[m_Down[j]] = m_Up[j];
+			m_ColumnSize[m_Column[j]]--;
+		}
+	}
+}
+
+template<int BoxSize>
+void BasicDlxSolver<BoxSize>::Uncover(int column)
+{
+	for (auto i = static_cast<int>(m_Up[column]); i != column; i = m_Up[i])
+	{
+		for (auto j = static_cast<int>(m_Left[i]); j != i; j = m_Left[j])
+		{
+			m_ColumnSize[m_Column[j]]++;
+			m_Down[m_Up[j]] = static_cast<Link>(j);
+			m_Up[m_Down[j]] = static_cast<Link>(j);
+		}
+	}
+
+	m_Right[m_Left[column]] = static_cast<Link>(column);
+	m_Left[m_Right[column]] = static_cast<Link>(column);
+	m_ColumnCovered[column] = false;
+}
+
+// Covers the columns of every other node in the row (the column of the given node is covered by the caller)
+template<int BoxSize>
+void BasicDlxSolver<BoxSize>::CoverRow(int node)
+{
+	for (auto j = static_cast<int>(m_Right[node]); j != node; j = m_Right[j])
+		Cover(m_Column[j]);
+}
+
+template<int BoxSize>
+void BasicDlxSolver<BoxSize>::UncoverRow(int node)
+{
+	for (auto j = static_cast<int>(m_Left[node]); j != node; j = m_Left[j])
+		Uncover(m_Column[j]);
+}
+
+template class BasicDlxSolver<2>;
+template class BasicDlxSolver<3>;
+template class BasicDlxSolver<4>;
+template class BasicDlxSolver<5>;
\ No newline at end of file
@@ -0,0 +1,79 @@
+#pragma once
+#ifndef DLX_SOLVER_H
+#define DLX_SOLVER_H
+
+#include "SudokuSolver.h"	// also includes "Board.h" and "Board_info.h"
+#include <functional>
+#include <limits>
+
+static constexpr auto UNLIMITED_SEARCH_STEPS = std::numeric_limits<int>::max();
+
+// Solves sudokus as an exact cover problem using Algorithm X over dancing links
+// The link matrix is built once and restored after every search, so reuse one solver per thread
+template<int BoxSize>
+class BasicDlxSolver final : public BasicSudokuSolver<BoxSize>
+{
+public:
+	static constexpr auto BOX_SIZE = BoardTraits<BoxSize>::BOX_SIZE;
+	static constexpr auto BOARD_SIZE = BoardTraits<BoxSize>::BOARD_SIZE;
+	static constexpr auto BOARD_CELLS = BoardTraits<BoxSize>::BOARD_CELLS;
+	using Grid = typename BoardTraits<BoxSize>::Grid;
+	// Called for every solution found, return false to stop the search
+	using SolutionVisitor = std::function<bool(const Grid&)>;
+
+	BasicDlxSolver();
+	using BasicSudokuSolver<BoxSize>::Solve;
+	using BasicSudokuSolver<BoxSize>::CountSolutions;
+	bool Solve(const Grid& puzzle, Grid& rSolution) override;
+	// Also returns false once stepLimit search steps were taken, so callers can restart on a heavy tail
+	bool Solve(const Grid& puzzle, Grid& rSolution, int stepLimit);
+	int CountSolutions(const Grid& puzzle, int limit = UNLIMITED_SOLUTIONS) override;
+	// Returns the amount of solutions passed to the visitor
+	int EnumerateSolutions(const Grid& puzzle, const SolutionVisitor& visitor, int limit = UNLIMITED_SOLUTIONS);
+	int EnumerateSolutions(const BasicBoard<BoxSize>& board, const SolutionVisitor& visitor, int limit = UNLIMITED_SOLUTIONS);
+
+	// Constraint columns: each cell filled, each value once per row, column and box
+	static constexpr auto CONSTRAINTS_PER_CELL = 4;
+	static constexpr auto COLUMN_COUNT = CONSTRAINTS_PER_CELL * BOARD_CELLS;
+	// Candidate rows: each value in each cell
+	static constexpr auto ROW_COUNT = BOARD_SIZE * BOARD_CELLS;
+	static constexpr auto NODE_COUNT = 1 + COLUMN_COUNT + CONSTRAINTS_PER_CELL * ROW_COUNT;
+
+private:
+	// Smallest type that can index every node
+	using Link = std::conditional_t<(NODE_COUNT <= std::numeric_limits<std::int16_t>::max()), std::int16_t, std::int32_t>;
+
+	// Node links, node 0 is the root and the column headers follow it
+	std::array<Link, NODE_COUNT> m_Left, m_Right, m_Up, m_Down, m_Column, m_Row;
+	std::array<Link, 1 + COLUMN_COUNT> m_ColumnSize;
+	std::array<bool, 1 + COLUMN_COUNT> m_ColumnCovered;
+	std::array<Link, ROW_COUNT> m_RowFirstNode;
+	// Search state
+	std::array<Link, BOARD_CELLS> m_ChosenRows;
+	int m_ChosenCount;
+	int m_SolutionCount;
+	int m_SolutionLimit;
+	int m_StepsLeft;
+	const Grid* mp_Puzzle;
+	const SolutionVisitor* mp_Visitor;
+	Grid* mp_FirstSolution;
+	bool m_Stopped;
+
+	int Run(const Grid& puzzle, int limit, const SolutionVisitor* pVisitor, Grid* pFirstSolution, int stepLimit = UNLIMITED_SEARCH_STEPS);
+	void Search();
+	void RecordSolution();
+	void Cover(int column);
+	void Uncover(int column);
+	void CoverRow(int node);
+	void UncoverRow(int node);
+};
+
+// Defined in DlxSolver.cpp for 4x4, 9x9, 16x16 and 25x25 boards
+extern template class BasicDlxSolver<2>;
+extern template class BasicDlxSolver<3>;
+extern template class BasicDlxSolver<4>;
+extern template class BasicDlxSolver<5>;
+
+using DlxSolver = BasicDlxSolver<BOX_SIZE>;
+
+#endif
\ No newline at end of file
@@ -13,33 +13,39 @@ void Game::Draw()
 	if (mp_CurrentScreen->GetID() == ScreenID::GAME)
 	{
 		// Draw tiles and board
-		m_Window.draw(m_Tiles, &m_TileTextures);
-		mp_SudokuBoard->Draw(m_Window, TILE_SIZE_PIXELS, sf::Vector2f(BOARD_FIRST_CELL_POSX, BOARD_FIRST_CELL_POSY));
+		if (m_TileBuffer.getVertexCount() > 0) { m_Window.draw(m_TileBuffer, &m_TileTextures); }
+		else { m_Window.draw(m_Tiles, &m_TileTextures); }
+		m_BoardRenderer.Draw(m_Window, *mp_SudokuBoard, TILE_SIZE_PIXELS, sf::Vector2f(BOARD_FIRST_CELL_POSX, BOARD_FIRST_CELL_POSY));
 
-		// Draw enemies that are not out of the gates first
-		for (auto& curEnemy : m_Enemies) { if (!curEnemy->IsOutOfGate()) { curEnemy->Draw(m_Window); } }
+		// Queue everything else in one pass, the queue sorts it into layers and actors by how low their feet are
+		// Enemies that are not out of the gates are drawn behind the gates, the rest with the other actors
+		for (auto& curEnemy : m_Enemies)
+		{
+			if (curEnemy->IsOutOfGate()) { curEnemy->Draw(m_RenderQueue, DrawOrder(DrawLayer::ACTORS, curEnemy->GetFeetCoordinate())); }
+			else { curEnemy->Draw(m_RenderQueue, DrawLayer::ENEMIES_IN_GATES); }
+		}
 
-		// Draw gates
-		for (auto& curGate : m_Gates) { curGate->Draw(m_Window); }
+		// Gates
+		for (auto& curGate : m_Gates) { curGate->Draw(m_RenderQueue, DrawLayer::GATES); }
 
-		// Draw enemies that are out of the gates next
-		for (auto& curEnemy : m_Enemies) { if (curEnemy->IsOutOfGate()) { curEnemy->Draw(m_Window); } }
+		// Player, before projectiles so anything stuck in them is drawn on top
+		mp_Player->Draw(m_RenderQueue, DrawOrder(DrawLayer::ACTORS, mp_Player->GetFeetCoordinate()));
 
-		// Draw non-alive non-explosive projectiles in front of enemies and behind player
-		// (e.g. hatchet stuck in enemy/floor, bullet blood splat on enemy)
+		// Alive or exploding projectiles go in front of actors (e.g. hatchet/grenade in air, grenade explosion), projectiles stuck
+		// in an actor share its depth (e.g. hatchet stuck in enemy, bullet blood splat on enemy), the rest go behind actors (e.g. hatchet stuck in floor)
 		for (auto& curProjectile : m_Projectiles)
-			if (curProjectile->GetStatus() != HealthStatus::ALIVE && !curProjectile->IsExploding()) { curProjectile->Draw(m_Window); }
+		{
+			auto* pAttachedActor = curProjectile->GetAttachedActor();
+			if (curProjectile->GetStatus() == HealthStatus::ALIVE || curProjectile->IsExploding()) { curProjectile->Draw(m_RenderQueue, DrawLayer::FLYING_PROJECTILES); }
+			else if (pAttachedActor != nullptr) { curProjectile->Draw(m_RenderQueue, DrawOrder(DrawLayer::ACTORS, pAttachedActor->GetFeetCoordinate())); }
+			else { curProjectile->Draw(m_RenderQueue, DrawLayer::STUCK_PROJECTILES); }
+		}
 
-		// Draw player
-		mp_Player->Draw(m_Window);
+		// Collectables
+		for (auto& curCollectable : m_Collectables) { curCollectable->Draw(m_RenderQueue, DrawLayer::COLLECTABLES); }
 
-		// Draw alive projectiles or exploding projectiles in front of enemies and player
-		// (e.g. hatchet/grenade in air, grenade explosion)
-		for (auto& curProjectile : m_Projectiles)
-			if (curProjectile->GetStatus() == HealthStatus::ALIVE || curProjectile->IsExploding()) { curProjectile->Draw(m_Window); }
-
-		// Draw collectables
-		for (auto& curCollectable : m_Collectables) { curCollectable->Draw(m_Window); }
+		// One ordered sweep, about one draw call per texture per layer
+		m_RenderQueue.Draw(m_Window);
 	}
 
 	switch (mp_CurrentScreen->GetID())
@@ -134,13 +134,13 @@ void Enemy::Update(float dtAsSeconds)
 	}
 }
 
-void Enemy::Draw(sf::RenderWindow& rWindow) const
+void Enemy::Draw(RenderQueue& rQueue, DrawOrder order) const
 {
-	Object::Draw(rWindow);
-	// Draw health bar ?
-	if (HasHealthBar() && m_OutOfGround && m_OutOfGate) { mp_HealthBar->Draw(rWindow); }
+	Object::Draw(rQueue, order);
+	// Draw health bar ? Kept on its own layer so all bars share a draw call
+	if (HasHealthBar() && m_OutOfGround && m_OutOfGate) { mp_HealthBar->Draw(rQueue, DrawLayer::HEALTH_BARS); }
 	// Spawning from ground ?
-	if (!m_OutOfGround) { rWindow.draw(ms_GroundLine); }
+	if (!m_OutOfGround) { rQueue.Add(ms_GroundLine, order); }
 }
 
 Enemy::Enemy(sf::Vector2f startPos, Direction primMov, float maxHealth, float primSpeed, float secSpeed) :
@@ -172,8 +172,8 @@ void Enemy::SpawnFromGate()
 	
 	// Shift x and y positions randomly
 	auto shift = static_cast<int>(HalfOf(TILE_SIZE_PIXELS));
-	SetPosX(GetPos().x + static_cast<float>(GetRandomNumberBetween(-shift, shift)));
-	SetPosY(GetPos().y + static_cast<float>(GetRandomNumberBetween(-shift, shift)));
+	SetPosX(GetPos().x + static_cast<float>(GetRandomNumberBetween(-shift, shift, RandomStream::AI)));
+	SetPosY(GetPos().y + static_cast<float>(GetRandomNumberBetween(-shift, shift, RandomStream::AI)));
 
 	// Default boundaries
 	auto minX = HalfOf(GetWidth()), maxX = TILE_SIZE_PIXELS - minX,
@@ -252,7 +252,7 @@ void Enemy::MoveTowards(sf::Vector2f pos, float speed)
 	SetPrimarySpeed(speed + ENEMY_SPEED_BOOST);
 
 	// Move diagonally ?
-	if (GetRandomBool())
+	if (GetRandomBool(RandomStream::AI))
 	{
 		// Dont if already close enough on secondary axis
 		auto sideDistance = (IsDirectionHorizontal(here.first) ? CalcDistOneAxis(pos.y, GetPos().y) : CalcDistOneAxis(pos.x, GetPos().x));
@@ -293,7 +293,7 @@ void Enemy::ExitGate()
 {
 	// Enemy must exit gate before they can start to see/hear player and get hit
 	// Add a small random value to make it look like each enemy has a slightly different reaction time
-	auto distToCover = GetMinDistanceToExitGate() + static_cast<float>(GetRandomNumberBetween(0, GATE_SPAWN_MAX_EXTRA_DIST));
+	auto distToCover = GetMinDistanceToExitGate() + static_cast<float>(GetRandomNumberBetween(0, GATE_SPAWN_MAX_EXTRA_DIST, RandomStream::AI));
 
 	// Enough distance covered ?
 	auto coveredDistance = CalcDistBetweenPoints(m_SpawnPos, GetPos());
@@ -303,7 +303,7 @@ void Enemy::ExitGate()
 		// Continue forward an additional random distance
 		else
 		{
-			auto randomDistance = GetRandomNumberBetween(static_cast<int>(HalfOf(TILE_SIZE_PIXELS)), static_cast<int>(TILE_SIZE_PIXELS));
+			auto randomDistance = GetRandomNumberBetween(static_cast<int>(HalfOf(TILE_SIZE_PIXELS)), static_cast<int>(TILE_SIZE_PIXELS), RandomStream::AI);
 			if (coveredDistance > distToCover + randomDistance) { m_OutOfGate = true; }
 		}
 	}
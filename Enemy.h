@@ -20,7 +20,7 @@ public:
 	virtual bool IsReadyForWallCollision() const final override;
 	virtual void HitWall(sf::Vector2f hitPos) override;
 	virtual void Update(float dtAsSeconds) override;
-	virtual void Draw(sf::RenderWindow& rWindow) const override;
+	virtual void Draw(RenderQueue& rQueue, DrawOrder order) const override;
 
 protected:
 	static inline Player* msp_Player;
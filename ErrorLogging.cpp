@@ -6,7 +6,7 @@
 static constexpr auto LOG_FILENAME = "log.txt";
 static constexpr auto LOG_DATE_TIME_FORMAT = "[%d %B %Y - %T] "; // e.g. [09 June 2020 - 14:38:01]
 
-static void AddErrorToLogFile(std::string errorDetails)
+static void AddErrorToLogFile(std::string_view errorDetails)
 {
 	// Get current calendar time and format it
 	const auto now = time(0);
@@ -21,7 +21,7 @@ static void AddErrorToLogFile(std::string errorDetails)
 	logFile.close();
 }
 
-void Assert(std::string errorDetails, bool condition)
+void Assert(std::string_view errorDetails, bool condition)
 {
 	if (!condition)
 	{
@@ -30,6 +30,11 @@ void Assert(std::string errorDetails, bool condition)
 	}
 }
 
+void LogError(std::string_view errorDetails)
+{
+	AddErrorToLogFile(errorDetails);
+}
+
 void DeleteLogFile()
 {
 	std::remove(LOG_FILENAME);
@@ -3,8 +3,12 @@
 #define ERROR_LOGGING
 
 #include <string>
+#include <string_view>
 
-void Assert(std::string errorMessage, bool condition = false);
+// Takes a view so passing checks never build a string
+void Assert(std::string_view errorMessage, bool condition = false);
+// For bad input data rather than programmer errors, logs without asserting
+void LogError(std::string_view errorMessage);
 void DeleteLogFile();
 
 #endif
\ No newline at end of file
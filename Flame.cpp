@@ -97,7 +97,7 @@ void Flame::Update(float dtAsSeconds)
 			else if (curScale.x > FLAME_DYING_SCALE_MAX || curScale.y > FLAME_DYING_SCALE_MAX) { m_SizeStatus = SizeStatus::SHRINKING; }
 			
 			// Determine size change
-			auto scale = GetRandomNumberBetween(FLAME_DYING_SCALE_MIN_MULTIPLIER, FLAME_DYING_SCALE_MAX_MULTIPLIER);
+			auto scale = GetRandomNumberBetween(FLAME_DYING_SCALE_MIN_MULTIPLIER, FLAME_DYING_SCALE_MAX_MULTIPLIER, RandomStream::WEAPONS);
 			scale = (m_SizeStatus == SizeStatus::GROWING) ? scale : -scale;
 			ScaleSpriteBy(dtAsSeconds * scale, dtAsSeconds * scale);
 		}
@@ -1,7 +1,7 @@
 #include "Game.h"
 #include "StartScreen.h"	// for StartScreen as first screen
 #include "FileCheck.h"		// for FileExists()
-#include "SavedData_info.h"	// for GetGameSavePath()
+#include "SavedData_info.h"	// for GetGameSavePath() and GetPuzzleBankPath()
 #include "Tile_info.h"		// for TILE_SIZE_PIXELS
 #include "Window_info.h"	// for WINDOW_HEIGHT_TILES and WINDOW_WIDTH_TILES
 
@@ -27,8 +27,9 @@ Game::Game()
 	m_Window.setIcon(m_Icon.getSize().x, m_Icon.getSize().y, m_Icon.getPixelsPtr());
 	m_Window.requestFocus();
 
-	// Load tile sprite sheet
+	// Load tile sprite sheet and build the tiles
 	m_TileTextures = TextureHolder::GetTexture(TextureHolder::GetPath(TILE_SHEET_FILENAME));
+	SetTVAfromTLA();
 
 	PlayBackgroundMusic(BACKGROUND_MUSIC_FILENAME);
 
@@ -52,6 +53,10 @@ Game::Game()
 
 	LoadHighscores();
 
+	// Start generating sudokus in the background so levels can start without waiting for one, unless a pre-generated bank covers every level
+	m_PuzzleBank.Open(GetPuzzleBankPath());
+	if (!m_PuzzleBank.IsComplete()) { m_PuzzlePool.Start(); }
+
 	// Show start screen
 	m_Screens.emplace_back(std::make_unique<StartScreen>(FileExists(GetGameSavePath())));
 	mp_CurrentScreen = m_Screens.back().get();
@@ -110,6 +115,10 @@ void Game::Close()
 	m_Projectiles.clear();
 	m_Collectables.clear();
 
+	// Stop generating sudokus
+	m_PuzzlePool.Stop();
+	m_PuzzleBank.Close();
+
 	// Reset unique pointers to delete the objects they're pointing to
 	mp_Player.reset();
 	mp_SudokuBoard.reset();
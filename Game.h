@@ -9,6 +9,10 @@
 #include "Projectile.h"
 #include "Collectable.h"
 #include "Board.h"			// also includes "Cell.h"
+#include "BoardRenderer.h"
+#include "RenderQueue.h"
+#include "PuzzlePool.h"
+#include "PuzzleBank.h"
 #include "Player.h"			// also includes "Actor.h", "Movable.h", "Object.h", "TextureHolder.h" and "SoundHolder.h"
 #include "ErrorLogging.h"	// for Assert() and DeleteLogFile()
 #include "Window_info.h"	// for WINDOW_HEIGHT_TILES and WINDOW_WIDTH_TILES
@@ -38,14 +42,17 @@ private:
 
 	// Window
 	sf::RenderWindow m_Window;
+	RenderQueue m_RenderQueue;
 	sf::Image m_Icon;
 
 	// Screens
 	std::vector<std::unique_ptr<Screen>> m_Screens;
 	Screen* mp_CurrentScreen;
 
-	// Tiles
+	// Tiles, built once and then only updated where the layout changes
+	// The buffer keeps them on the GPU, the array is the copy tiles are written to and the fallback without buffer support
 	sf::VertexArray m_Tiles;
+	sf::VertexBuffer m_TileBuffer;
 	sf::Texture m_TileTextures;
 	int m_HighlightedTileIndex;
 	int m_TileLayout[WINDOW_HEIGHT_TILES][WINDOW_WIDTH_TILES] =
@@ -72,6 +79,9 @@ private:
 
 	// Sudoku board
 	std::unique_ptr<Board> mp_SudokuBoard = std::make_unique<Board>();
+	BoardRenderer m_BoardRenderer;
+	PuzzlePool m_PuzzlePool;
+	PuzzleBank m_PuzzleBank;
 	bool m_SudokuCompleted;
 
 	// Scores
@@ -110,6 +120,8 @@ private:
 	// Tile management
 	void CreateGates();
 	void SetTVAfromTLA();
+	void UpdateTile(int column, int row);
+	void SetTileQuad(int column, int row);
 	void HighlightPlayerTile();
 	sf::Vector2f GetRandomIncorrectCellPos() const;
 
@@ -5,6 +5,7 @@
 #include "Tile_info.h"				// for TILE_SIZE
 #include "Highscore_info.h"			// for SCORE_MAX_WIDTH
 #include "Difficulty_info.h"		// for GetDifficultyString()
+#include "Technique.h"				// for GetTechniqueString()
 
 static constexpr auto GAME_SCREEN_CLASS_NAME = "Game";
 // Input sounds
@@ -30,10 +31,21 @@ static constexpr auto HUD_LEVEL_DIFFICULTY_SEPERATOR = " - ";
 static constexpr auto HUD_TIME_TEXT = "TIME ";
 static constexpr auto HUD_TIME_FORMAT_WIDTH = 2;
 static constexpr auto HUD_SCORE_TEXT = "SCORE ";
+// Hint
+static constexpr auto HUD_VERTICAL_ALIGNMENT_HINT = 0.07f;
+static constexpr auto HUD_HORIZONTAL_ALIGNMENT_HINT = 0.5f;
+static constexpr auto HUD_HINT_TEXT = "HINT: ";
+static constexpr auto HUD_NO_HINT_TEXT = "NO HINT";
+static constexpr auto HINT_TEXT_DISPLAY_SECONDS = 4.0f;
+// Pencil marks
+static constexpr auto HUD_HORIZONTAL_ALIGNMENT_PENCIL = 0.5f;
+static constexpr auto HUD_PENCIL_TEXT = "PENCIL";
+// Nothing shown yet, so the first update lays out every HUD text
+static constexpr auto HUD_NOT_SHOWN = -1;
 
-static void PrintHUDText(sf::RenderWindow& rWindow, sf::Vector2f alignment, std::string text, int size)
+static HudText CreateHUDText(sf::Vector2f windowSize, sf::Vector2f alignment, int size)
 {
-	PrintText(rWindow, alignment, text, size, DEFAULT_TEXT_COLOR, DEFAULT_TEXT_OUTLINE_COLOR, HUD_TEXT_OUTLINE_SIZE);
+	return HudText(sf::Vector2f(windowSize.x * alignment.x, windowSize.y * alignment.y), size, HUD_TEXT_OUTLINE_SIZE);
 }
 
 GameScreen::GameScreen(int& rDifficulty, int& rLevel, Timer& rTimeRemaining, Board& rSudokuBoard, Player& rPlayer, int& rKillsScore, int& rHighlightedCellIndex) :
@@ -44,8 +56,23 @@ GameScreen::GameScreen(int& rDifficulty, int& rLevel, Timer& rTimeRemaining, Boa
 	mr_Player(rPlayer),
 	mr_KillsScore(rKillsScore),
 	mr_HighlightedCellIndex(rHighlightedCellIndex),
-	m_HealthBar(sf::Vector2f(HEALTH_BAR_WIDTH, HEALTH_BAR_HEIGHT), sf::Vector2f(ms_windowSize.x * HEALTH_BAR_HORIZONTAL_ALIGNMENT, ms_windowSize.y * HUD_VERTICAL_ALIGNMENT_TOP))
+	m_HealthBar(sf::Vector2f(HEALTH_BAR_WIDTH, HEALTH_BAR_HEIGHT), sf::Vector2f(ms_windowSize.x * HEALTH_BAR_HORIZONTAL_ALIGNMENT, ms_windowSize.y * HUD_VERTICAL_ALIGNMENT_TOP)),
+	m_LevelDifficultyText(CreateHUDText(ms_windowSize, sf::Vector2f(HUD_HORIZONTAL_ALIGNMENT_LEVEL, HUD_VERTICAL_ALIGNMENT_TOP), HUD_TEXT_SIZE_SMALL)),
+	m_TimeText(CreateHUDText(ms_windowSize, sf::Vector2f(HUD_HORIZONTAL_ALIGNMENT_TIME, HUD_VERTICAL_ALIGNMENT_BOTTOM), HUD_TEXT_SIZE_LARGE)),
+	m_KillsScoreText(CreateHUDText(ms_windowSize, sf::Vector2f(HUD_HORIZONTAL_ALIGNMENT_SCORE, HUD_VERTICAL_ALIGNMENT_BOTTOM), HUD_TEXT_SIZE_LARGE)),
+	m_ShownLevel(HUD_NOT_SHOWN),
+	m_ShownDifficulty(HUD_NOT_SHOWN),
+	m_ShownMinutes(HUD_NOT_SHOWN),
+	m_ShownSeconds(HUD_NOT_SHOWN),
+	m_ShownKillsScore(HUD_NOT_SHOWN),
+	m_ShownHealth(HUD_NOT_SHOWN),
+	m_ShownMaxHealth(HUD_NOT_SHOWN),
+	m_HintText(CreateHUDText(ms_windowSize, sf::Vector2f(HUD_HORIZONTAL_ALIGNMENT_HINT, HUD_VERTICAL_ALIGNMENT_HINT), HUD_TEXT_SIZE_SMALL)),
+	m_HintTextSecondsLeft(),
+	m_PencilMode(false),
+	m_PencilText(CreateHUDText(ms_windowSize, sf::Vector2f(HUD_HORIZONTAL_ALIGNMENT_PENCIL, HUD_VERTICAL_ALIGNMENT_BOTTOM), HUD_TEXT_SIZE_SMALL))
 {
+	m_PencilText.SetString(HUD_PENCIL_TEXT);
 	m_Menu->AddOption(EMPTY_STR, ScreenID::PAUSE);
 	SetSprite(m_HealthIcon, sf::Vector2f(ms_windowSize.x * HEALTH_ICON_HORIZONTAL_ALIGNMENT, ms_windowSize.y * HUD_VERTICAL_ALIGNMENT_TOP), HEALTH_ICON_FILENAME);
 }
@@ -60,11 +87,36 @@ void GameScreen::HandleEventInput(sf::Event event)
 	// Handle the player changing cell values
 	if (event.type == sf::Event::KeyPressed)
 	{
+		// Highlight the next cell that can be deduced and name how
+		if (IsHintKey(event.key.code))
+		{
+			auto hint = m_HintFinder.FindHint(mr_Board);
+			if (hint.cellIndex != NO_HINTED_CELL)
+			{
+				mr_Board.SetHintedCell(hint.cellIndex);
+				m_HintText.SetString(std::string(HUD_HINT_TEXT).append(GetTechniqueString(hint.technique)));
+			}
+			else { m_HintText.SetString(HUD_NO_HINT_TEXT); }
+			m_HintTextSecondsLeft = HINT_TEXT_DISPLAY_SECONDS;
+		}
+
+		// Switch between entering guesses and pencil marks
+		if (IsPencilModeKey(event.key.code)) { m_PencilMode = !m_PencilMode; }
+
+		// Mark every empty cell with the values its row, column and box still allow
+		if (IsFillPencilMarksKey(event.key.code)) { mr_Board.FillPencilMarks(); }
+
 		// On modifiable cell ?
 		if (mr_Board.IsCellHidden(mr_HighlightedCellIndex))
 		{
+			// Toggle pencil mark
+			if (m_PencilMode && IsDigitKey(event.key.code))
+				mr_Board.TogglePencilMark(mr_HighlightedCellIndex, GetDigitForKey(event.key.code));
+			// Clear pencil marks, guesses are cleared the usual way
+			else if (m_PencilMode && IsClearCellKey(event.key.code) && mr_Board.IsCellEmpty(mr_HighlightedCellIndex))
+				mr_Board.ClearPencilMarks(mr_HighlightedCellIndex);
 			// Enter value
-			if (IsDigitKey(event.key.code))
+			else if (IsDigitKey(event.key.code))
 			{
 				mr_Board.EnterCellGuess(mr_HighlightedCellIndex, GetDigitForKey(event.key.code));
 				PlaySound(GAME_SCREEN_ENTER_SOUND_FILENAME);
@@ -143,30 +195,61 @@ void GameScreen::Draw(sf::RenderWindow& rWindow) const
 	rWindow.draw(m_HealthIcon);
 
 	// Level & Difficulty
-	PrintHUDText(rWindow, sf::Vector2f(HUD_HORIZONTAL_ALIGNMENT_LEVEL, HUD_VERTICAL_ALIGNMENT_TOP), m_LevelDifficultyText, HUD_TEXT_SIZE_SMALL);
+	m_LevelDifficultyText.Draw(rWindow);
 
 	// Time
-	PrintHUDText(rWindow, sf::Vector2f(HUD_HORIZONTAL_ALIGNMENT_TIME, HUD_VERTICAL_ALIGNMENT_BOTTOM), std::string(HUD_TIME_TEXT).append(m_TimeText), HUD_TEXT_SIZE_LARGE);
+	m_TimeText.Draw(rWindow);
 
 	// Score
-	PrintHUDText(rWindow, sf::Vector2f(HUD_HORIZONTAL_ALIGNMENT_SCORE, HUD_VERTICAL_ALIGNMENT_BOTTOM), std::string(HUD_SCORE_TEXT).append(m_KillsScoreText), HUD_TEXT_SIZE_LARGE);
+	m_KillsScoreText.Draw(rWindow);
+
+	// Hint
+	if (m_HintTextSecondsLeft > 0.0f) { m_HintText.Draw(rWindow); }
+
+	// Pencil marks
+	if (m_PencilMode) { m_PencilText.Draw(rWindow); }
 }
 
 void GameScreen::Update(float dtAsSeconds)
 {
+	// Each part of the HUD is only laid out again when the value it shows changes
 	// Health
-	m_HealthBar.Update(mr_Player.GetHealth(), mr_Player.GetMaxHealth());
+	if (mr_Player.GetHealth() != m_ShownHealth || mr_Player.GetMaxHealth() != m_ShownMaxHealth)
+	{
+		m_ShownHealth = mr_Player.GetHealth();
+		m_ShownMaxHealth = mr_Player.GetMaxHealth();
+		m_HealthBar.Update(m_ShownHealth, m_ShownMaxHealth);
+	}
 
 	// Level & Difficulty
-	m_LevelDifficultyText = std::string(HUD_LEVEL_TEXT).append(std::to_string(mr_Level)).append(HUD_LEVEL_DIFFICULTY_SEPERATOR).append(GetDifficultyString(mr_Difficulty));
+	if (mr_Level != m_ShownLevel || mr_Difficulty != m_ShownDifficulty)
+	{
+		m_ShownLevel = mr_Level;
+		m_ShownDifficulty = mr_Difficulty;
+		m_LevelDifficultyText.SetString(std::string(HUD_LEVEL_TEXT).append(std::to_string(mr_Level)).append(HUD_LEVEL_DIFFICULTY_SEPERATOR).append(GetDifficultyString(mr_Difficulty)));
+	}
 
 	// Time
-	auto minutes = FillWithCharacters(std::to_string(GetMinutes(mr_TimeRemaining.GetTimeLeft())), ZERO_CHAR, FillType::LEADING, HUD_TIME_FORMAT_WIDTH);
-	auto seconds = FillWithCharacters(std::to_string(GetSeconds(mr_TimeRemaining.GetTimeLeft())), ZERO_CHAR, FillType::LEADING, HUD_TIME_FORMAT_WIDTH);
-	m_TimeText = minutes.append(":").append(seconds);
+	auto minutes = GetMinutes(mr_TimeRemaining.GetTimeLeft());
+	auto seconds = GetSeconds(mr_TimeRemaining.GetTimeLeft());
+	if (minutes != m_ShownMinutes || seconds != m_ShownSeconds)
+	{
+		m_ShownMinutes = minutes;
+		m_ShownSeconds = seconds;
+		auto minutesText = FillWithCharacters(std::to_string(minutes), ZERO_CHAR, FillType::LEADING, HUD_TIME_FORMAT_WIDTH);
+		auto secondsText = FillWithCharacters(std::to_string(seconds), ZERO_CHAR, FillType::LEADING, HUD_TIME_FORMAT_WIDTH);
+		m_TimeText.SetString(std::string(HUD_TIME_TEXT).append(minutesText).append(":").append(secondsText));
+	}
 
 	// Score
-	m_KillsScoreText = FillWithCharacters(std::to_string(mr_KillsScore), ZERO_CHAR, FillType::LEADING, SCORE_MAX_WIDTH);
+	if (mr_KillsScore != m_ShownKillsScore)
+	{
+		m_ShownKillsScore = mr_KillsScore;
+		m_KillsScoreText.SetString(std::string(HUD_SCORE_TEXT).append(FillWithCharacters(std::to_string(mr_KillsScore), ZERO_CHAR, FillType::LEADING, SCORE_MAX_WIDTH)));
+	}
+
+	// Hint
+	if (m_HintTextSecondsLeft > 0.0f) { m_HintTextSecondsLeft -= dtAsSeconds; }
 }
 
 const std::string GameScreen::GetClassName() const
@@ -7,6 +7,8 @@
 #include "Board.h"
 #include "Player.h"
 #include "HealthBar.h"
+#include "PuzzleGrader.h"
+#include "HudText.h"
 
 class GameScreen : public Screen
 {
@@ -28,7 +30,16 @@ private:
 	int& mr_HighlightedCellIndex;
 	sf::Sprite m_HealthIcon;
 	HealthBar m_HealthBar;
-	std::string m_KillsScoreText, m_TimeText, m_LevelDifficultyText;
+	HudText m_LevelDifficultyText, m_TimeText, m_KillsScoreText;
+	// What the HUD was last laid out for, it only changes when one of these does
+	int m_ShownLevel, m_ShownDifficulty, m_ShownMinutes, m_ShownSeconds, m_ShownKillsScore;
+	float m_ShownHealth, m_ShownMaxHealth;
+	PuzzleGrader m_HintFinder;
+	HudText m_HintText;
+	float m_HintTextSecondsLeft;
+	// Digits toggle pencil marks instead of entering a guess
+	bool m_PencilMode;
+	HudText m_PencilText;
 
 	virtual const std::string GetClassName() const final override;
 };
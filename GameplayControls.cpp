@@ -8,6 +8,9 @@ static constexpr auto MOVE_DOWN_KEY = sf::Keyboard::Down;
 static constexpr auto MOVE_LEFT_KEY = sf::Keyboard::Left;
 static constexpr auto MOVE_RIGHT_KEY = sf::Keyboard::Right;
 static constexpr auto CLEAR_CELL_KEY = sf::Keyboard::BackSpace;
+static constexpr auto HINT_KEY = sf::Keyboard::H;
+static constexpr auto PENCIL_MODE_KEY = sf::Keyboard::P;
+static constexpr auto FILL_PENCIL_MARKS_KEY = sf::Keyboard::F;
 static constexpr auto ERROR_NOT_DIGIT_KEY = "Not a digit key - use IsDigitKey() to check key first";
 static constexpr auto ERROR_NOT_DIRECTION_KEY = "Not a direction key - use IsDirectionKey() to check key first";
 
@@ -46,6 +49,21 @@ bool IsClearCellKey(sf::Keyboard::Key key)
 	return key == CLEAR_CELL_KEY;
 }
 
+bool IsHintKey(sf::Keyboard::Key key)
+{
+	return key == HINT_KEY;
+}
+
+bool IsPencilModeKey(sf::Keyboard::Key key)
+{
+	return key == PENCIL_MODE_KEY;
+}
+
+bool IsFillPencilMarksKey(sf::Keyboard::Key key)
+{
+	return key == FILL_PENCIL_MARKS_KEY;
+}
+
 // Returns whether the given keyboard key is a digit key
 bool IsDigitKey(sf::Keyboard::Key key)
 {
@@ -14,6 +14,9 @@ bool IsMoveRightKeyPressed();
 // Key identification
 bool IsSwapWeaponKey(sf::Keyboard::Key key);
 bool IsClearCellKey(sf::Keyboard::Key key);
+bool IsHintKey(sf::Keyboard::Key key);
+bool IsPencilModeKey(sf::Keyboard::Key key);
+bool IsFillPencilMarksKey(sf::Keyboard::Key key);
 bool IsDigitKey(sf::Keyboard::Key key);
 bool IsDirectionKey(sf::Keyboard::Key key);
 // Key values
@@ -0,0 +1,70 @@
+#include "GridTransform.h"
+#include <utility>			// for swap()
+
+template<int BoxSize>
+BasicGridTransform<BoxSize>::BasicGridTransform() :
+	m_SourceCells(),
+	m_Values()
+{
+	for (auto cell = 0; cell < BOARD_CELLS; cell++) { m_SourceCells[cell] = static_cast<std::uint16_t>(cell); }
+	for (auto value = 0; value <= BOARD_SIZE; value++) { m_Values[value] = static_cast<std::uint8_t>(value); }
+}
+
+template<int BoxSize>
+BasicGridTransform<BoxSize> BasicGridTransform<BoxSize>::CreateRandom(RandomStream stream)
+{
+	BasicGridTransform transform;
+
+	// Relabel the values with a random shuffle, index 0 is left as the empty value
+	for (auto value = BOARD_SIZE; value > 1; value--)
+		std::swap(transform.m_Values[value], transform.m_Values[GetRandomNumberBetween(1, value, stream)]);
+
+	auto rowOrder = CreateRandomLineOrder(stream);
+	auto columnOrder = CreateRandomLineOrder(stream);
+	auto transpose = GetRandomBool(stream);
+
+	for (auto row = 0; row < BOARD_SIZE; row++)
+	{
+		for (auto column = 0; column < BOARD_SIZE; column++)
+		{
+			auto sourceRow = rowOrder[row];
+			auto sourceColumn = columnOrder[column];
+			if (transpose) { std::swap(sourceRow, sourceColumn); }
+			transform.m_SourceCells[row * BOARD_SIZE + column] = static_cast<std::uint16_t>(sourceRow * BOARD_SIZE + sourceColumn);
+		}
+	}
+
+	return transform;
+}
+
+template<int BoxSize>
+typename BasicGridTransform<BoxSize>::Grid BasicGridTransform<BoxSize>::Apply(const Grid& grid) const
+{
+	Grid transformed;
+	for (auto cell = 0; cell < BOARD_CELLS; cell++) { transformed[cell] = m_Values[grid[m_SourceCells[cell]]]; }
+	return transformed;
+}
+
+template<int BoxSize>
+typename BasicGridTransform<BoxSize>::LineOrder BasicGridTransform<BoxSize>::CreateRandomLineOrder(RandomStream stream)
+{
+	std::array<int, BOX_SIZE> bands;
+	for (auto band = 0; band < BOX_SIZE; band++) { bands[band] = band; }
+	for (auto band = BOX_SIZE - 1; band > 0; band--) { std::swap(bands[band], bands[GetRandomNumberBetween(0, band, stream)]); }
+
+	LineOrder lines;
+	for (auto band = 0; band < BOX_SIZE; band++)
+	{
+		// Lines only move within their band, otherwise boxes would be broken up
+		auto* pBandLines = lines.data() + band * BOX_SIZE;
+		for (auto line = 0; line < BOX_SIZE; line++) { pBandLines[line] = bands[band] * BOX_SIZE + line; }
+		for (auto line = BOX_SIZE - 1; line > 0; line--) { std::swap(pBandLines[line], pBandLines[GetRandomNumberBetween(0, line, stream)]); }
+	}
+
+	return lines;
+}
+
+template class BasicGridTransform<2>;
+template class BasicGridTransform<3>;
+template class BasicGridTransform<4>;
+template class BasicGridTransform<5>;
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+#ifndef GRID_TRANSFORM_H
+#define GRID_TRANSFORM_H
+
+#include "Board_info.h"		// for BoardTraits and BOX_SIZE
+#include "Random.h"			// for RandomStream
+#include <array>
+#include <cstdint>
+
+// A symmetry of the sudoku rules, maps any valid grid to another valid grid
+// Made of a relabelling of the values, row swaps within bands, column swaps within stacks, band and stack swaps and a transposition
+// Givens and solution transformed by the same transform stay a matching puzzle with the same difficulty
+template<int BoxSize>
+class BasicGridTransform
+{
+public:
+	static constexpr auto BOX_SIZE = BoardTraits<BoxSize>::BOX_SIZE;
+	static constexpr auto BOARD_SIZE = BoardTraits<BoxSize>::BOARD_SIZE;
+	static constexpr auto BOARD_CELLS = BoardTraits<BoxSize>::BOARD_CELLS;
+	using Grid = typename BoardTraits<BoxSize>::Grid;
+
+	// Leaves grids unchanged
+	BasicGridTransform();
+	// One of the 9! * 6^8 * 2 (about 1.2 trillion) transforms of a 9x9 grid, picked uniformly
+	static BasicGridTransform CreateRandom(RandomStream stream = RandomStream::BOARD);
+	// A single pass over precomputed tables, the cost is the same for every transform
+	Grid Apply(const Grid& grid) const;
+
+private:
+	using LineOrder = std::array<int, BOARD_SIZE>;
+
+	// Row-major index of the cell each cell is copied from
+	std::array<std::uint16_t, BOARD_CELLS> m_SourceCells;
+	// New value of each value, EMPTY_CELL_VALUE stays empty
+	std::array<std::uint8_t, BOARD_SIZE + 1> m_Values;
+
+	// Shuffles whole bands, then the lines within each band
+	static LineOrder CreateRandomLineOrder(RandomStream stream);
+};
+
+// Defined in GridTransform.cpp for 4x4, 9x9, 16x16 and 25x25 boards
+extern template class BasicGridTransform<2>;
+extern template class BasicGridTransform<3>;
+extern template class BasicGridTransform<4>;
+extern template class BasicGridTransform<5>;
+
+using GridTransform = BasicGridTransform<BOX_SIZE>;
+
+#endif
\ No newline at end of file
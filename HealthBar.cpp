@@ -47,4 +47,17 @@ void HealthBar::Draw(sf::RenderWindow& rWindow) const
 {
 	rWindow.draw(m_HealthBarOutline);
 	rWindow.draw(m_HealthBarFill);
+}
+
+// The same rectangles the shapes draw, with the outline split into four sides so the see-through inside stays see-through
+void HealthBar::Draw(RenderQueue& rQueue, DrawOrder order) const
+{
+	auto inside = sf::FloatRect(m_HealthBarOutline.getPosition() - m_HealthBarOutline.getOrigin(), m_Size);
+	auto outline = HEALTH_BAR_OUTLINE_THICKNESS;
+	rQueue.Add(inside, HEALTH_BAR_EMPTY_COLOR, order);
+	rQueue.Add(sf::FloatRect(inside.left - outline, inside.top - outline, inside.width + 2 * outline, outline), HEALTH_BAR_OUTLINE_COLOR, order);
+	rQueue.Add(sf::FloatRect(inside.left - outline, inside.top + inside.height, inside.width + 2 * outline, outline), HEALTH_BAR_OUTLINE_COLOR, order);
+	rQueue.Add(sf::FloatRect(inside.left - outline, inside.top, outline, inside.height), HEALTH_BAR_OUTLINE_COLOR, order);
+	rQueue.Add(sf::FloatRect(inside.left + inside.width, inside.top, outline, inside.height), HEALTH_BAR_OUTLINE_COLOR, order);
+	rQueue.Add(sf::FloatRect(m_HealthBarFill.getPosition() - m_HealthBarFill.getOrigin(), m_HealthBarFill.getSize()), HEALTH_BAR_FILL_COLOR, order);
 }
\ No newline at end of file
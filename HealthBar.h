@@ -4,6 +4,7 @@
 
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
+#include "RenderQueue.h"
 
 class HealthBar
 {
@@ -13,6 +14,7 @@ public:
 	void Update(float currentHealth, float fullHealth); // without changing position
 	void Update(float currentHealth, float fullHealth, sf::Vector2f pos);
 	void Draw(sf::RenderWindow& rWindow) const;
+	void Draw(RenderQueue& rQueue, DrawOrder order) const;
 
 private:
 	sf::Vector2f m_Size;
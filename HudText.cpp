@@ -0,0 +1,27 @@
+#include "HudText.h"
+#include <cmath>		// for roundf()
+
+HudText::HudText(sf::Vector2f pos, int size, float outlineThickness, FontStyle font) :
+	m_Pos(roundf(pos.x), roundf(pos.y))	// round to fix outline distortments
+{
+	m_Text.setFont(GetFont(font));
+	m_Text.setCharacterSize(static_cast<unsigned int>(size));
+	m_Text.setFillColor(DEFAULT_TEXT_COLOR);
+	m_Text.setOutlineColor(DEFAULT_TEXT_OUTLINE_COLOR);
+	m_Text.setOutlineThickness(outlineThickness);
+}
+
+void HudText::SetString(const std::string& text)
+{
+	m_Text.setString(text);
+
+	// Center and position, the same way PrintText() does
+	auto textBox = m_Text.getLocalBounds();
+	m_Text.setOrigin(sf::Vector2f(textBox.left + roundf(0.5f * (textBox.width)), textBox.top + roundf(0.5f * (textBox.height))));
+	m_Text.setPosition(m_Pos);
+}
+
+void HudText::Draw(sf::RenderWindow& rWindow) const
+{
+	rWindow.draw(m_Text);
+}
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+#ifndef HUD_TEXT_H
+#define HUD_TEXT_H
+
+#include "TextPrinting.h"	// for FontStyle, DEFAULT_TEXT_COLOR and DEFAULT_TEXT_OUTLINE_COLOR
+
+// A line of text that keeps its glyph geometry between frames, centered on its position like PrintText() does
+// Only laid out again when its string is set, so drawing it allocates nothing
+class HudText
+{
+public:
+	HudText(sf::Vector2f pos, int size, float outlineThickness, FontStyle font = DEFAULT_FONT_STYLE);
+	void SetString(const std::string& text);
+	void Draw(sf::RenderWindow& rWindow) const;
+
+private:
+	sf::Vector2f m_Pos;
+	sf::Text m_Text;
+};
+
+#endif
\ No newline at end of file
@@ -1,7 +1,7 @@
 #include "Game.h"
 #include "Pistol.h"			// for PISTOL_ID
 #include "NewGameScreen.h"	// for dynamic_cast<NewGameScreen&> to get difficulty
-#include "Level_info.h"		// for GetFirstLevel(), GetLevelTime() and GetAmountOfNumbersToHide()
+#include "Level_info.h"		// for GetFirstLevel() and GetLevelTime()
 #include "Spawn_info.h"		// for spawn functions
 
 static constexpr auto DEFAULT_SCORE = 0;
@@ -45,6 +45,5 @@ void Game::PrepareLevel()
 	m_LargeEnemySpawnCount = 0;
 	// Sudoku board
 	m_SudokuCompleted = false;
-	mp_SudokuBoard->GenerateNewSudoku();
-	mp_SudokuBoard->HideCells(GetAmountOfNumbersToHide(m_Difficulty, m_Level));
+	if (!m_PuzzleBank.LoadRandomPuzzle(*mp_SudokuBoard, m_Difficulty, m_Level)) { m_PuzzlePool.TakeBoard(*mp_SudokuBoard, m_Difficulty, m_Level); }
 }
\ No newline at end of file
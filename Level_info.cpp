@@ -28,6 +28,11 @@ int GetFirstLevel()
 	return FIRST_LEVEL;
 }
 
+int GetNumberOfLevels()
+{
+	return FINAL_LEVEL - FIRST_LEVEL + 1;
+}
+
 // Between 9-18, 27-36 or 45-54 hidden values
 int GetAmountOfNumbersToHide(int difficulty, int level)
 {
@@ -6,6 +6,7 @@
 bool IsNewWeaponUnlocked(int level);
 bool IsFinalLevel(int level);
 int GetFirstLevel();
+int GetNumberOfLevels();
 int GetAmountOfNumbersToHide(int difficulty, int level);
 float GetLevelTime(int difficulty);
 void ValidateLevel(int level);
@@ -1,9 +1,13 @@
 #include "Game.h"
+#include "Random.h"		// for SeedRandomStreams()
+#include <cstdlib>		// for strtoull()
+#include <ctime>		// for time()
 
-int main()
+int main(int argc, char* argv[])
 {
-	// Seed random number generator with current time
-	srand((unsigned int)time(0));
+	// Seed random number streams with current time, or replay a session with a seed given on the command line
+	auto seed = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : static_cast<unsigned long long>(time(0));
+	SeedRandomStreams(seed);
 
 	// Start game
 	Game::Instance().Run();
@@ -52,9 +52,9 @@ void Movable::HitWall(sf::Vector2f hitPos)
 	SetPos(hitPos);
 }
 
-void Movable::Draw(sf::RenderWindow& rWindow) const
+void Movable::Draw(RenderQueue& rQueue, DrawOrder order) const
 {
-	if (GetStatus() != HealthStatus::DEAD) { Object::Draw(rWindow); }
+	if (GetStatus() != HealthStatus::DEAD) { Object::Draw(rQueue, order); }
 }
 
 Movable::Movable(sf::Vector2f startPos, float dyingTimer, Direction primMov, float primSpeed, Direction secMov, float secSpeed) :
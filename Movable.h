@@ -23,7 +23,7 @@ public:
 	virtual bool IsReadyForCollision() const;
 	virtual bool IsReadyForWallCollision() const;
 	virtual void HitWall(sf::Vector2f hitPos);
-	virtual void Draw(sf::RenderWindow& rWindow) const override;
+	virtual void Draw(RenderQueue& rQueue, DrawOrder order) const override;
 
 protected:
 	Timer m_HitTimer;
@@ -114,9 +114,11 @@ void Object::SetSpriteScale(float scaleX, float scaleY)
 	m_Sprite.setScale(scaleX, scaleY);
 }
 
+// Keeps the top left corner, which is where the image starts on its atlas page
 void Object::ChangeSpriteTextureRectangle(float width, float height)
 {
-	m_Sprite.setTextureRect(sf::IntRect(0, 0, static_cast<int>(width), static_cast<int>(height)));
+	auto rect = m_Sprite.getTextureRect();
+	m_Sprite.setTextureRect(sf::IntRect(rect.left, rect.top, static_cast<int>(width), static_cast<int>(height)));
 }
 
 void Object::FlipSpriteHorizontally()
@@ -215,4 +217,9 @@ void Object::SetSoundVolume(std::unique_ptr<sf::Sound>& rpSound, float value)
 void Object::Draw(sf::RenderWindow& rWindow) const
 {
 	rWindow.draw(m_Sprite);
+}
+
+void Object::Draw(RenderQueue& rQueue, DrawOrder order) const
+{
+	rQueue.Add(m_Sprite, order);
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "TextureHolder.h"		// for sf::Sprite and functions
 #include "SoundHolder.h"		// for sf::Sound and functions
 #include "ErrorLogging.h"		// for Assert()
+#include "RenderQueue.h"		// for DrawOrder
 
 static constexpr auto DEFAULT_SCALE = 1.0f;
 static constexpr auto SPRITE_MAX_SIZE = 200.0f;
@@ -27,6 +28,8 @@ public:
 	virtual void Pause();
 	virtual void Resume();
 	virtual void Draw(sf::RenderWindow& rWindow) const;
+	// Game objects are queued and drawn in batches, screens draw straight to the window
+	virtual void Draw(RenderQueue& rQueue, DrawOrder order) const;
 
 protected:
 	Object(sf::Vector2f startPos = DEFAULT_POSITION);
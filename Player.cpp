@@ -1,6 +1,6 @@
 #include "Player.h"
 #include <sstream>				// for stringstream
-#include "Random.h"				// for TakeRandomElementFromSet()
+#include "Random.h"				// for IndexableBag
 #include "Mathematics.h"		// for HalfOf()
 #include "TextCharacters.h"		// for SPACE_CHAR
 #include "Weapons_info.h"		// for weapon IDs and classes
@@ -21,7 +21,8 @@ static constexpr auto PLAYER_WEAPON_HOLD_OFFSET_DIRECTION = Direction::RIGHT; //
 static int ChooseRandomNewWeapon(std::string ownedWeapons)
 {
 	// Start off with all weapon IDs
-	std::set<int> newWeaponIDs = ALL_WEAPON_IDS;
+	IndexableBag<WEAPON_ID_LIMIT> newWeaponIDs;
+	for (auto weaponID : ALL_WEAPON_IDS) { newWeaponIDs.Insert(weaponID); }
 
 	// Remove owned weapons from set
 	std::stringstream ss;
@@ -31,14 +32,12 @@ static int ChooseRandomNewWeapon(std::string ownedWeapons)
 	while (!ss.eof())
 	{
 		ss >> weaponToRemove;
-		newWeaponIDs.erase(weaponToRemove);
+		newWeaponIDs.Remove(weaponToRemove);
 	}
 	ss.clear();
 
-	auto newWeaponsLeft = static_cast<int>(newWeaponIDs.size());
-
 	// Any weapons left to unlock ?
-	if (newWeaponsLeft > 0) { return TakeRandomElementFromSet(newWeaponIDs); }
+	if (!newWeaponIDs.IsEmpty()) { return newWeaponIDs.GetRandom(RandomStream::WEAPONS); }
 	else { Assert(ERROR_ALL_WEAPONS_UNLOCKED); }
 }
 
@@ -218,14 +217,15 @@ void Player::Update(float dtAsSeconds)
 	}
 }
 
-void Player::Draw(sf::RenderWindow& rWindow) const
+void Player::Draw(RenderQueue& rQueue, DrawOrder order) const
 {
 	// Draw the player behind weapon unless facing UP and weapon is a throwable
+	// Both share the player's depth, whichever is added first is drawn first
 	auto playerBehindWeapon = !(GetFacing() == Direction::UP && GetEquippedWeapon()->IsThrowable());
-	if (playerBehindWeapon) { Object::Draw(rWindow); }
+	if (playerBehindWeapon) { Object::Draw(rQueue, order); }
 	// Only draw the weapon if player is alive
-	if (Player::GetStatus() == HealthStatus::ALIVE) { GetEquippedWeapon()->Draw(rWindow); }
-	if (!playerBehindWeapon) { Object::Draw(rWindow); }
+	if (Player::GetStatus() == HealthStatus::ALIVE) { GetEquippedWeapon()->Draw(rQueue, order); }
+	if (!playerBehindWeapon) { Object::Draw(rQueue, order); }
 }
 
 void Player::UseWeapon()
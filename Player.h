@@ -27,7 +27,7 @@ public:
 	virtual void Pause() final override;
 	virtual void Resume() final override;
 	virtual void Update(float dtAsSeconds) final override;
-	virtual void Draw(sf::RenderWindow& rWindow) const final override;
+	virtual void Draw(RenderQueue& rQueue, DrawOrder order) const final override;
 
 private:
 	std::vector<std::unique_ptr<Weapon>> m_Weapons;
@@ -29,6 +29,12 @@ bool Projectile::IsExploding() const
 	return GetStatus() == HealthStatus::DYING && GetIsExplosive();
 }
 
+// Returns the actor the projectile is stuck in, if any
+const Actor* Projectile::GetAttachedActor() const
+{
+	return mp_Attach != nullptr ? mp_Attach->pActor : nullptr;
+}
+
 bool Projectile::IsReadyForWallCollision() const
 {
 	return GetStatus() == HealthStatus::ALIVE && m_WallHitTimer.RanOut() && GetPrimaryMovement() != Direction::NONE;
@@ -125,11 +131,11 @@ void Projectile::Update(float dtAsSeconds)
 	}
 }
 
-void Projectile::Draw(sf::RenderWindow& rWindow) const
+void Projectile::Draw(RenderQueue& rQueue, DrawOrder order) const
 {
 	// Only draw projectiles whose dying timer has not ran out yet, this prevents drawing projectiles
 	// that are technically still dying due to their dying sound still playing (e.g. exploding grenade)
-	if (GetDyingTimeLeft() > DEFAULT_TIMER_VALUE) { Object::Draw(rWindow); }
+	if (GetDyingTimeLeft() > DEFAULT_TIMER_VALUE) { Object::Draw(rQueue, order); }
 }
 
 Projectile::Projectile(sf::Vector2f startPos, float dyingTimer, Direction primMov, float primSpeed) :
@@ -171,11 +177,11 @@ void Projectile::MakeTrajectorySpread(float minPrimarySpeed, float maxPrimarySpe
 	Assert(ERROR_PROJECTILE_PRIM_SPEED_GREATER_THAN_LIMIT, maxPrimarySpeed <= PROJECTILE_MAX_SPEED);
 	Assert(ERROR_PROJECTILE_SPREAD_MIN_SPEED_TOO_SLOW, minPrimarySpeed >= THROWABLE_MAX_SPEED);
 
-	if (IsDirectionHorizontal(GetPrimaryMovement())) { SetSecondaryMovement(GetRandomBool() ? Direction::DOWN : Direction::UP); }
-	else if (IsDirectionVertical(GetPrimaryMovement())) { SetSecondaryMovement(GetRandomBool() ? Direction::RIGHT : Direction::LEFT); }
+	if (IsDirectionHorizontal(GetPrimaryMovement())) { SetSecondaryMovement(GetRandomBool(RandomStream::WEAPONS) ? Direction::DOWN : Direction::UP); }
+	else if (IsDirectionVertical(GetPrimaryMovement())) { SetSecondaryMovement(GetRandomBool(RandomStream::WEAPONS) ? Direction::RIGHT : Direction::LEFT); }
 
-	SetPrimarySpeed(static_cast<float>(GetRandomNumberBetween(static_cast<int>(minPrimarySpeed), static_cast<int>(maxPrimarySpeed))));
-	SetSecondarySpeed(static_cast<float>(GetRandomNumberBetween(static_cast<int>(DEFAULT_SPEED), static_cast<int>(maxAbsoluteSecondarySpeed))));
+	SetPrimarySpeed(static_cast<float>(GetRandomNumberBetween(static_cast<int>(minPrimarySpeed), static_cast<int>(maxPrimarySpeed), RandomStream::WEAPONS)));
+	SetSecondarySpeed(static_cast<float>(GetRandomNumberBetween(static_cast<int>(DEFAULT_SPEED), static_cast<int>(maxAbsoluteSecondarySpeed), RandomStream::WEAPONS)));
 }
 
 sf::Vector2f Projectile::GetSpawnOffset() const
@@ -252,5 +258,5 @@ float Projectile::GetRotationRate() const
 
 float Projectile::GetDyingRotation() const
 {
-	return GetRandomAngleOfMultiple(PROJECTILE_DEFAULT_DYING_ROTATION_MULTIPLE);
+	return GetRandomAngleOfMultiple(PROJECTILE_DEFAULT_DYING_ROTATION_MULTIPLE, RandomStream::WEAPONS);
 }
\ No newline at end of file
@@ -31,13 +31,14 @@ class Projectile : public Movable
 public:
 	float GetDistanceLeftToTravel() const;
 	bool IsExploding() const;
+	const Actor* GetAttachedActor() const;
 	virtual ~Projectile() noexcept = default;
 	virtual void HitActor(Actor& actor);
 	virtual bool IsReadyForWallCollision() const final override;
 	virtual bool IsReadyForCollision() const final override;
 	virtual void HitWall(sf::Vector2f hitPos) override;
 	virtual void Update(float dtAsSeconds) override;
-	virtual void Draw(sf::RenderWindow& rWindow) const override;
+	virtual void Draw(RenderQueue& rQueue, DrawOrder order) const override;
 
 protected:
 	Timer m_WallHitTimer;
@@ -0,0 +1,307 @@
+#include "PuzzleBank.h"
+#include "Level_info.h"			// for GetFirstLevel(), GetNumberOfLevels(), ValidateLevel() and GetAmountOfNumbersToHide()
+#include "Difficulty_info.h"	// for GetNumberOfDifficulties() and ValidateDifficulty()
+#include "BoardTopology.h"		// for BOARD_TOPOLOGY
+#include "ErrorLogging.h"		// for LogError()
+#include "Random.h"				// for GetRandomNumberBetween()
+#include "GridTransform.h"		// for CreateRandom() and Apply()
+#include <cstring>				// for memcmp() and memcpy()
+#include <fstream>				// for ofstream
+#ifdef _WIN32
+	#define WIN32_LEAN_AND_MEAN
+	#define NOMINMAX
+	#include <windows.h>		// for CreateFileMapping() and MapViewOfFile()
+#else
+	#include <fcntl.h>			// for open()
+	#include <sys/mman.h>		// for mmap()
+	#include <sys/stat.h>		// for fstat()
+	#include <unistd.h>			// for close()
+#endif
+
+static constexpr char BANK_MAGIC[4] = { 'S', 'D', 'K', 'B' };
+static constexpr auto BANK_VERSION = 1u;
+static constexpr auto BITS_PER_BYTE = 8;
+static constexpr auto VALUE_BITS = 4;
+static constexpr auto VALUE_MASK = 0x0F;
+
+static constexpr auto ERROR_BANK_VALUE_OUT_OF_RANGE = "Puzzle bank record holds a value that is not between 1 and BOARD_SIZE - the bank is corrupt, regenerate it with PuzzleBatch.";
+static constexpr auto ERROR_BANK_SOLUTION_REPEATS_VALUE = "Puzzle bank record holds a solution that repeats a value in a row, column or box - the bank is corrupt, regenerate it with PuzzleBatch.";
+static constexpr auto ERROR_BANK_HIDDEN_COUNT_MISMATCH = "Puzzle bank record hides a different amount of cells than its level - the bank is corrupt, regenerate it with PuzzleBatch.";
+
+// Maps the whole file read-only, returns nullptr if it cannot be opened
+static const std::uint8_t* MapFile(const std::string& filename, std::size_t& rSize)
+{
+#ifdef _WIN32
+	auto file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) { return nullptr; }
+
+	LARGE_INTEGER size;
+	void* pView = nullptr;
+	if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+	{
+		auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping != nullptr)
+		{
+			pView = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			// The view keeps the mapping alive
+			CloseHandle(mapping);
+		}
+		rSize = static_cast<std::size_t>(size.QuadPart);
+	}
+	CloseHandle(file);
+	return static_cast<const std::uint8_t*>(pView);
+#else
+	auto file = open(filename.c_str(), O_RDONLY);
+	if (file < 0) { return nullptr; }
+
+	struct stat status;
+	void* pView = nullptr;
+	if (fstat(file, &status) == 0 && status.st_size > 0)
+	{
+		pView = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+		if (pView == MAP_FAILED) { pView = nullptr; }
+		rSize = static_cast<std::size_t>(status.st_size);
+	}
+	// The mapping keeps the file alive
+	close(file);
+	return static_cast<const std::uint8_t*>(pView);
+#endif
+}
+
+static void UnmapFile(const std::uint8_t* pData, [[maybe_unused]] std::size_t size)
+{
+#ifdef _WIN32
+	UnmapViewOfFile(pData);
+#else
+	munmap(const_cast<std::uint8_t*>(pData), size);
+#endif
+}
+
+PuzzleBank::PuzzleBank() :
+	mp_Data(nullptr),
+	m_Size(),
+	mp_Index(nullptr),
+	mp_Records(nullptr)
+{
+}
+
+PuzzleBank::~PuzzleBank()
+{
+	Close();
+}
+
+bool PuzzleBank::Open(const std::string& filename)
+{
+	Close();
+
+	mp_Data = MapFile(filename, m_Size);
+	if (mp_Data == nullptr) { return false; }
+
+	mp_Index = mp_Data + sizeof(Header);
+	mp_Records = mp_Index + GetIndexEntryCount() * sizeof(IndexEntry);
+
+	// Not a bank this build can read ? Leave it to runtime generation
+	if (!IsValid())
+	{
+		Close();
+		return false;
+	}
+
+	return true;
+}
+
+void PuzzleBank::Close()
+{
+	if (mp_Data != nullptr) { UnmapFile(mp_Data, m_Size); }
+	mp_Data = nullptr;
+	m_Size = 0;
+	mp_Index = nullptr;
+	mp_Records = nullptr;
+}
+
+bool PuzzleBank::IsOpen() const
+{
+	return mp_Data != nullptr;
+}
+
+bool PuzzleBank::IsComplete() const
+{
+	if (!IsOpen()) { return false; }
+
+	for (auto position = 0; position < GetIndexEntryCount(); position++)
+		if (ReadIndexEntry(position).recordCount == 0) { return false; }
+
+	return true;
+}
+
+int PuzzleBank::GetPuzzleCount(int difficulty, int level) const
+{
+	if (!IsOpen()) { return 0; }
+	return static_cast<int>(ReadIndexEntry(GetIndexEntryPosition(difficulty, level)).recordCount);
+}
+
+bool PuzzleBank::LoadRandomPuzzle(Board& rBoard, int difficulty, int level) const
+{
+	if (!IsOpen()) { return false; }
+
+	auto entry = ReadIndexEntry(GetIndexEntryPosition(difficulty, level));
+	if (entry.recordCount == 0) { return false; }
+
+	auto recordIndex = entry.firstRecord + static_cast<std::uint32_t>(GetRandomNumberBetween(0, static_cast<int>(entry.recordCount) - 1, RandomStream::BOARD));
+
+	// Unpack straight into grids on the stack, a corrupt record is left to runtime generation
+	SudokuGrid givens;
+	SudokuGrid solution;
+	if (!DecodeRecord(recordIndex, GetAmountOfNumbersToHide(difficulty, level), givens, solution)) { return false; }
+
+	// The same symmetry applied to both keeps the puzzle and its difficulty, so a small bank rarely repeats a board
+	auto transform = GridTransform::CreateRandom();
+	rBoard.LoadSudoku(transform.Apply(givens), transform.Apply(solution));
+	return true;
+}
+
+bool PuzzleBank::ReadAllPuzzles(std::vector<BankPuzzle>& rPuzzles) const
+{
+	if (!IsOpen()) { return false; }
+
+	for (auto difficulty = 0; difficulty < GetNumberOfDifficulties(); difficulty++)
+	{
+		for (auto level = GetFirstLevel(); level < GetFirstLevel() + GetNumberOfLevels(); level++)
+		{
+			auto entry = ReadIndexEntry(GetIndexEntryPosition(difficulty, level));
+			for (auto record = entry.firstRecord; record < entry.firstRecord + entry.recordCount; record++)
+			{
+				BankPuzzle puzzle = { difficulty, level, {}, {} };
+				if (!DecodeRecord(record, GetAmountOfNumbersToHide(difficulty, level), puzzle.givens, puzzle.solution)) { return false; }
+				rPuzzles.push_back(puzzle);
+			}
+		}
+	}
+
+	return true;
+}
+
+bool PuzzleBank::Write(const std::string& filename, const std::vector<BankPuzzle>& puzzles)
+{
+	// Count the puzzles of each difficulty and level to know where each group starts
+	std::vector<IndexEntry> index(GetIndexEntryCount(), IndexEntry{ 0, 0 });
+	for (const auto& puzzle : puzzles) { index[GetIndexEntryPosition(puzzle.difficulty, puzzle.level)].recordCount++; }
+	for (size_t position = 1; position < index.size(); position++)
+		index[position].firstRecord = index[position - 1].firstRecord + index[position - 1].recordCount;
+
+	// Pack each puzzle into its group's next free record
+	std::vector<std::uint8_t> records(puzzles.size() * RECORD_SIZE, 0);
+	auto nextRecord = index;
+	for (const auto& puzzle : puzzles)
+	{
+		auto& recordIndex = nextRecord[GetIndexEntryPosition(puzzle.difficulty, puzzle.level)].firstRecord;
+		auto* pRecord = records.data() + static_cast<std::size_t>(recordIndex++) * RECORD_SIZE;
+		auto* pHiddenMask = pRecord + SOLUTION_BYTES;
+
+		for (auto cell = 0; cell < BOARD_CELLS; cell++)
+		{
+			pRecord[cell / 2] |= static_cast<std::uint8_t>(puzzle.solution[cell] << ((cell % 2) * VALUE_BITS));
+			if (puzzle.givens[cell] == EMPTY_CELL_VALUE)
+				pHiddenMask[cell / BITS_PER_BYTE] |= static_cast<std::uint8_t>(1 << (cell % BITS_PER_BYTE));
+		}
+	}
+
+	Header header;
+	std::memcpy(header.magic, BANK_MAGIC, sizeof(BANK_MAGIC));
+	header.version = BANK_VERSION;
+	header.boardCells = BOARD_CELLS;
+	header.recordSize = RECORD_SIZE;
+	header.indexEntryCount = static_cast<std::uint32_t>(index.size());
+
+	std::ofstream file(filename, std::ios_base::binary);
+	if (!file.is_open()) { return false; }
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	file.write(reinterpret_cast<const char*>(index.data()), index.size() * sizeof(IndexEntry));
+	file.write(reinterpret_cast<const char*>(records.data()), records.size());
+	return file.good();
+}
+
+// Returns false if a value is not a digit, the solution breaks a row, column or box, or the record does not hide the amount of cells its level hides
+bool PuzzleBank::DecodeRecord(std::uint32_t recordIndex, int amountHidden, SudokuGrid& rGivens, SudokuGrid& rSolution) const
+{
+	const auto* pRecord = mp_Records + static_cast<std::size_t>(recordIndex) * RECORD_SIZE;
+	const auto* pHiddenMask = pRecord + SOLUTION_BYTES;
+
+	auto hiddenCount = 0;
+	for (auto cell = 0; cell < BOARD_CELLS; cell++)
+	{
+		auto value = (pRecord[cell / 2] >> ((cell % 2) * VALUE_BITS)) & VALUE_MASK;
+		if (value < 1 || value > BOARD_SIZE)
+		{
+			LogError(ERROR_BANK_VALUE_OUT_OF_RANGE);
+			return false;
+		}
+
+		auto hidden = (pHiddenMask[cell / BITS_PER_BYTE] >> (cell % BITS_PER_BYTE)) & 1;
+		hiddenCount += hidden;
+		rSolution[cell] = static_cast<std::uint8_t>(value);
+		rGivens[cell] = static_cast<std::uint8_t>(hidden ? EMPTY_CELL_VALUE : value);
+	}
+
+	// All values are in range, so a unit whose mask has every bit set holds each value exactly once
+	for (const auto& unit : BOARD_TOPOLOGY<BOX_SIZE>.units)
+	{
+		auto shown = static_cast<CandidateMask>(NO_CANDIDATES);
+		for (auto gridIndex : unit) { shown |= GetCandidateBit(rSolution[gridIndex]); }
+		if (shown != ALL_CANDIDATES)
+		{
+			LogError(ERROR_BANK_SOLUTION_REPEATS_VALUE);
+			return false;
+		}
+	}
+
+	if (hiddenCount != amountHidden)
+	{
+		LogError(ERROR_BANK_HIDDEN_COUNT_MISMATCH);
+		return false;
+	}
+
+	return true;
+}
+
+int PuzzleBank::GetIndexEntryCount()
+{
+	return GetNumberOfDifficulties() * GetNumberOfLevels();
+}
+
+int PuzzleBank::GetIndexEntryPosition(int difficulty, int level)
+{
+	ValidateDifficulty(difficulty);
+	ValidateLevel(level);
+	return difficulty * GetNumberOfLevels() + (level - GetFirstLevel());
+}
+
+PuzzleBank::IndexEntry PuzzleBank::ReadIndexEntry(int position) const
+{
+	// Copied out since the mapped bytes have no alignment guarantees
+	IndexEntry entry;
+	std::memcpy(&entry, mp_Index + position * sizeof(IndexEntry), sizeof(IndexEntry));
+	return entry;
+}
+
+bool PuzzleBank::IsValid() const
+{
+	auto indexSize = GetIndexEntryCount() * sizeof(IndexEntry);
+	if (m_Size < sizeof(Header) + indexSize) { return false; }
+
+	Header header;
+	std::memcpy(&header, mp_Data, sizeof(Header));
+	if (std::memcmp(header.magic, BANK_MAGIC, sizeof(BANK_MAGIC)) != 0 || header.version != BANK_VERSION
+		|| header.boardCells != BOARD_CELLS || header.recordSize != RECORD_SIZE
+		|| header.indexEntryCount != static_cast<std::uint32_t>(GetIndexEntryCount())) { return false; }
+
+	// Every group must lie inside the file
+	auto recordsSize = m_Size - sizeof(Header) - indexSize;
+	for (auto position = 0; position < GetIndexEntryCount(); position++)
+	{
+		auto entry = ReadIndexEntry(position);
+		if ((static_cast<std::size_t>(entry.firstRecord) + entry.recordCount) * RECORD_SIZE > recordsSize) { return false; }
+	}
+
+	return true;
+}
\ No newline at end of file
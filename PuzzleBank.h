@@ -0,0 +1,82 @@
+#pragma once
+#ifndef PUZZLE_BANK_H
+#define PUZZLE_BANK_H
+
+#include "Board.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// A puzzle as written to a bank, grids are in row order
+struct BankPuzzle
+{
+	int difficulty;
+	int level;
+	SudokuGrid givens;
+	SudokuGrid solution;
+};
+
+// Read-only view of a memory-mapped puzzle bank file
+// Layout: header, then one index entry per difficulty and level, then fixed size records grouped by that index
+// Each record packs the solution two values per byte followed by a bitmask of the hidden cells
+class PuzzleBank
+{
+public:
+	static constexpr auto FILE_EXTENSION = ".bank";
+
+	PuzzleBank();
+	~PuzzleBank();
+	// Returns false if the file is missing or not a bank for this board size and level layout
+	bool Open(const std::string& filename);
+	void Close();
+	bool IsOpen() const;
+	// True if every difficulty and level has at least one puzzle
+	bool IsComplete() const;
+	int GetPuzzleCount(int difficulty, int level) const;
+	// Decodes a random puzzle straight from the mapped file into rBoard under a random symmetry transform
+	// Returns false if there are none for that level
+	bool LoadRandomPuzzle(Board& rBoard, int difficulty, int level) const;
+	// Appends every puzzle in the bank to rPuzzles, returns false if a record is corrupt
+	bool ReadAllPuzzles(std::vector<BankPuzzle>& rPuzzles) const;
+	// Puzzles can be in any order, they are grouped by difficulty and level when written
+	static bool Write(const std::string& filename, const std::vector<BankPuzzle>& puzzles);
+
+	PuzzleBank(PuzzleBank&&) = delete;					// move ctor
+	PuzzleBank(PuzzleBank const&) = delete;				// copy ctor
+	void operator=(PuzzleBank&&) = delete;				// move assignment
+	void operator=(PuzzleBank const&) = delete;			// copy assignment
+
+private:
+	struct Header
+	{
+		char magic[4];
+		std::uint32_t version;
+		std::uint32_t boardCells;
+		std::uint32_t recordSize;
+		std::uint32_t indexEntryCount;
+	};
+
+	struct IndexEntry
+	{
+		std::uint32_t firstRecord;
+		std::uint32_t recordCount;
+	};
+
+	static constexpr auto SOLUTION_BYTES = (BOARD_CELLS + 1) / 2;
+	static constexpr auto HIDDEN_MASK_BYTES = (BOARD_CELLS + 7) / 8;
+	static constexpr auto RECORD_SIZE = SOLUTION_BYTES + HIDDEN_MASK_BYTES;
+
+	const std::uint8_t* mp_Data;
+	std::size_t m_Size;
+	const std::uint8_t* mp_Index;
+	const std::uint8_t* mp_Records;
+
+	// Index entries are keyed the same way as GetAmountOfNumbersToHide()
+	static int GetIndexEntryCount();
+	static int GetIndexEntryPosition(int difficulty, int level);
+	IndexEntry ReadIndexEntry(int position) const;
+	bool DecodeRecord(std::uint32_t recordIndex, int amountHidden, SudokuGrid& rGivens, SudokuGrid& rSolution) const;
+	bool IsValid() const;
+};
+
+#endif
\ No newline at end of file
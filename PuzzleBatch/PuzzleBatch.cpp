@@ -0,0 +1,287 @@
+// Generates banks of sudokus offline, without opening a window
+// Usage: PuzzleBatch <puzzles per difficulty> <output file> [threads] [seed]
+// Output files ending in PuzzleBank::FILE_EXTENSION are written as a binary bank the game can load, anything else as text
+// Puzzles already in the output file are kept and the new ones added after them
+// Puzzles that are symmetric variants of one generated earlier, in this run or any run sharing the output file, are dropped
+// The canonical hashes of every puzzle in the output file are stored next to it, with PuzzleIndex::FILE_EXTENSION appended
+#include "PuzzlePool.h"			// for GenerateBoard()
+#include "PuzzleBank.h"			// for BankPuzzle, ReadAllPuzzles() and Write()
+#include "PuzzleCanonicalizer.h"	// for Canonicalize()
+#include "PuzzleIndex.h"		// for Open(), Clear(), Insert() and Save()
+#include "Difficulty_info.h"	// for GetNumberOfDifficulties()
+#include "Level_info.h"			// for GetFirstLevel() and GetNumberOfLevels()
+#include "Random.h"				// for SeedRandomStreams() and DeriveRandomSeed()
+#include <algorithm>			// for nth_element()
+#include <atomic>
+#include <chrono>				// for steady_clock
+#include <cstdlib>				// for atoi() and strtoull()
+#include <ctime>				// for time()
+#include <filesystem>			// for exists()
+#include <fstream>				// for ifstream and ofstream
+#include <iostream>				// for cout and cerr
+#include <string>
+#include <thread>
+#include <vector>
+
+static constexpr auto USAGE = "Usage: PuzzleBatch <puzzles per difficulty> <output file> [threads] [seed]";
+static constexpr auto GRID_CHARACTER_OFFSET = '0';
+
+struct BatchJob
+{
+	int difficulty;
+	int level;
+};
+
+struct WorkerReport
+{
+	int generatedCount = 0;
+	double busySeconds = 0.0;
+	std::vector<double> latencies;
+};
+
+using Clock = std::chrono::steady_clock;
+
+static double GetSecondsBetween(Clock::time_point start, Clock::time_point end)
+{
+	return std::chrono::duration<double>(end - start).count();
+}
+
+// Each difficulty gets the same amount of puzzles, spread evenly over its levels
+static std::vector<BatchJob> CreateJobs(int puzzlesPerDifficulty)
+{
+	std::vector<BatchJob> jobs;
+	jobs.reserve(static_cast<size_t>(puzzlesPerDifficulty) * GetNumberOfDifficulties());
+
+	for (auto difficulty = 0; difficulty < GetNumberOfDifficulties(); difficulty++)
+		for (auto i = 0; i < puzzlesPerDifficulty; i++)
+			jobs.push_back({ difficulty, GetFirstLevel() + i % GetNumberOfLevels() });
+
+	return jobs;
+}
+
+// Workers pull the next job from a shared counter, so fast and slow generations balance out
+static void RunWorker(std::uint64_t seed, const std::vector<BatchJob>& jobs, std::atomic<int>& rNextJob,
+	std::vector<BankPuzzle>& rPuzzles, std::vector<PuzzleHash>& rHashes, WorkerReport& rReport)
+{
+	Board board;
+	PuzzleCanonicalizer canonicalizer;
+
+	for (auto job = rNextJob++; job < static_cast<int>(jobs.size()); job = rNextJob++)
+	{
+		// Seeded per job rather than per worker, so a seed gives the same puzzles on any number of threads
+		SeedRandomStreams(DeriveRandomSeed(seed, job));
+		auto start = Clock::now();
+		PuzzlePool::GenerateBoard(board, jobs[job].difficulty, jobs[job].level);
+		auto latency = GetSecondsBetween(start, Clock::now());
+
+		rPuzzles[job] = { jobs[job].difficulty, jobs[job].level, board.GetGivenGrid(), board.GetSolutionGrid() };
+		rHashes[job] = canonicalizer.Canonicalize(rPuzzles[job].givens, rPuzzles[job].solution).hash;
+		rReport.generatedCount++;
+		rReport.busySeconds += latency;
+		rReport.latencies.push_back(latency);
+	}
+}
+
+static std::string GetGridString(const SudokuGrid& grid)
+{
+	std::string gridString(grid.size(), GRID_CHARACTER_OFFSET);
+	for (size_t i = 0; i < grid.size(); i++) { gridString[i] = static_cast<char>(GRID_CHARACTER_OFFSET + grid[i]); }
+	return gridString;
+}
+
+// Returns false if the string is not one digit (0 for hidden cells) per cell
+static bool ParseGridString(const std::string& gridString, SudokuGrid& rGrid)
+{
+	if (gridString.size() != rGrid.size()) { return false; }
+
+	for (size_t i = 0; i < rGrid.size(); i++)
+	{
+		auto value = gridString[i] - GRID_CHARACTER_OFFSET;
+		if (value < EMPTY_CELL_VALUE || value > BOARD_SIZE) { return false; }
+		rGrid[i] = static_cast<std::uint8_t>(value);
+	}
+	return true;
+}
+
+static bool IsBankFilename(const std::string& filename)
+{
+	std::string extension = PuzzleBank::FILE_EXTENSION;
+	return filename.size() >= extension.size() && filename.compare(filename.size() - extension.size(), extension.size(), extension) == 0;
+}
+
+// Reads back what WriteTextPuzzles() writes
+static bool ReadTextPuzzles(const std::string& filename, std::vector<BankPuzzle>& rPuzzles)
+{
+	std::ifstream file(filename);
+	if (!file.is_open()) { return false; }
+
+	BankPuzzle puzzle;
+	std::string givens, solution;
+	while (file >> puzzle.difficulty >> puzzle.level >> givens >> solution)
+	{
+		if (puzzle.difficulty < 0 || puzzle.difficulty >= GetNumberOfDifficulties()
+			|| puzzle.level < GetFirstLevel() || puzzle.level >= GetFirstLevel() + GetNumberOfLevels()
+			|| !ParseGridString(givens, puzzle.givens) || !ParseGridString(solution, puzzle.solution)) { return false; }
+		rPuzzles.push_back(puzzle);
+	}
+
+	return file.eof();
+}
+
+// The bank is unmapped again before returning, so the file can be written over
+static bool ReadBankPuzzles(const std::string& filename, std::vector<BankPuzzle>& rPuzzles)
+{
+	PuzzleBank bank;
+	return bank.Open(filename) && bank.ReadAllPuzzles(rPuzzles);
+}
+
+// A missing file has no puzzles, returns false if the file is there but is not a puzzle file
+static bool ReadPuzzles(const std::string& filename, std::vector<BankPuzzle>& rPuzzles)
+{
+	if (!std::filesystem::exists(filename)) { return true; }
+	return IsBankFilename(filename) ? ReadBankPuzzles(filename, rPuzzles) : ReadTextPuzzles(filename, rPuzzles);
+}
+
+// One puzzle per line: difficulty, level, givens (0 for hidden cells) and solution, both in row order
+static bool WriteTextPuzzles(const std::string& filename, const std::vector<BankPuzzle>& puzzles)
+{
+	std::ofstream file(filename);
+	if (!file.is_open()) { return false; }
+
+	for (const auto& puzzle : puzzles)
+		file << puzzle.difficulty << ' ' << puzzle.level << ' ' << GetGridString(puzzle.givens) << ' ' << GetGridString(puzzle.solution) << '\n';
+
+	return file.good();
+}
+
+// Partially reorders the latencies in place, only the element at the percentile ends up where a full sort would put it
+static double GetPercentile(std::vector<double>& rLatencies, double percentile)
+{
+	auto index = static_cast<size_t>(percentile * (rLatencies.size() - 1));
+	std::nth_element(rLatencies.begin(), rLatencies.begin() + index, rLatencies.end());
+	return rLatencies[index];
+}
+
+static bool WritePuzzles(const std::string& filename, const std::vector<BankPuzzle>& puzzles)
+{
+	return IsBankFilename(filename) ? PuzzleBank::Write(filename, puzzles) : WriteTextPuzzles(filename, puzzles);
+}
+
+static std::vector<PuzzleHash> HashPuzzles(const std::vector<BankPuzzle>& puzzles)
+{
+	PuzzleCanonicalizer canonicalizer;
+	std::vector<PuzzleHash> hashes;
+	hashes.reserve(puzzles.size());
+	for (const auto& puzzle : puzzles) { hashes.push_back(canonicalizer.Canonicalize(puzzle.givens, puzzle.solution).hash); }
+	return hashes;
+}
+
+// Keeps the first of each set of symmetric puzzles, returns how many were dropped
+static int RemoveDuplicates(PuzzleIndex& rIndex, std::vector<BankPuzzle>& rPuzzles, const std::vector<PuzzleHash>& hashes)
+{
+	size_t kept = 0;
+	for (size_t i = 0; i < rPuzzles.size(); i++)
+		if (rIndex.Insert(hashes[i])) { rPuzzles[kept++] = rPuzzles[i]; }
+
+	auto droppedCount = static_cast<int>(rPuzzles.size() - kept);
+	rPuzzles.resize(kept);
+	return droppedCount;
+}
+
+static void PrintReport(const std::vector<WorkerReport>& reports, double wallSeconds)
+{
+	std::vector<double> latencies;
+	for (const auto& report : reports) { latencies.insert(latencies.end(), report.latencies.begin(), report.latencies.end()); }
+	if (latencies.empty()) { return; }
+
+	std::cout << "Generated " << latencies.size() << " puzzles in " << wallSeconds << " s, "
+		<< latencies.size() / wallSeconds << " puzzles/sec\n";
+
+	for (size_t i = 0; i < reports.size(); i++)
+	{
+		auto perSecond = (reports[i].busySeconds > 0.0) ? reports[i].generatedCount / reports[i].busySeconds : 0.0;
+		std::cout << "  Thread " << i << ": " << reports[i].generatedCount << " puzzles, " << perSecond << " puzzles/sec\n";
+	}
+
+	auto total = 0.0;
+	for (auto latency : latencies) { total += latency; }
+	std::cout << "Latency (ms): mean " << total / latencies.size() * 1000.0
+		<< ", p50 " << GetPercentile(latencies, 0.50) * 1000.0
+		<< ", p90 " << GetPercentile(latencies, 0.90) * 1000.0
+		<< ", p99 " << GetPercentile(latencies, 0.99) * 1000.0
+		<< ", max " << GetPercentile(latencies, 1.00) * 1000.0 << "\n";
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 3 || argc > 5)
+	{
+		std::cerr << USAGE << "\n";
+		return EXIT_FAILURE;
+	}
+
+	auto puzzlesPerDifficulty = std::atoi(argv[1]);
+	std::string filename = argv[2];
+	auto threadCount = (argc >= 4) ? std::atoi(argv[3]) : static_cast<int>(std::thread::hardware_concurrency());
+	auto seed = (argc == 5) ? std::strtoull(argv[4], nullptr, 10) : static_cast<unsigned long long>(time(0));
+	if (puzzlesPerDifficulty <= 0 || threadCount <= 0)
+	{
+		std::cerr << USAGE << "\n";
+		return EXIT_FAILURE;
+	}
+
+	auto jobs = CreateJobs(puzzlesPerDifficulty);
+	std::vector<BankPuzzle> puzzles(jobs.size());
+	std::vector<PuzzleHash> hashes(jobs.size());
+	std::vector<WorkerReport> reports(threadCount);
+	std::atomic<int> nextJob = 0;
+
+	std::cout << "Generating " << puzzlesPerDifficulty << " puzzles for each of " << GetNumberOfDifficulties()
+		<< " difficulties on " << threadCount << " threads with seed " << seed << "\n";
+
+	auto start = Clock::now();
+	{
+		std::vector<std::jthread> workers;
+		for (auto i = 0; i < threadCount; i++)
+			workers.emplace_back(RunWorker, seed, std::cref(jobs), std::ref(nextJob), std::ref(puzzles), std::ref(hashes), std::ref(reports[i]));
+	}
+	auto wallSeconds = GetSecondsBetween(start, Clock::now());
+
+	PrintReport(reports, wallSeconds);
+
+	std::vector<BankPuzzle> keptPuzzles;
+	if (!ReadPuzzles(filename, keptPuzzles))
+	{
+		std::cerr << filename << " is not a puzzle file, it was left as it is\n";
+		return EXIT_FAILURE;
+	}
+
+	// The index must only list puzzles in the output file, otherwise new puzzles get dropped for ones that are not there
+	auto indexFilename = filename + PuzzleIndex::FILE_EXTENSION;
+	PuzzleIndex index;
+	if (!index.Open(indexFilename) || index.GetCount() != static_cast<int>(keptPuzzles.size()))
+	{
+		std::cout << "Rebuilding " << indexFilename << " from the " << keptPuzzles.size() << " puzzles in " << filename << "\n";
+		index.Clear();
+		RemoveDuplicates(index, keptPuzzles, HashPuzzles(keptPuzzles));
+	}
+	auto droppedCount = RemoveDuplicates(index, puzzles, hashes);
+	std::cout << "Dropped " << droppedCount << " puzzles already in " << filename << " or repeated in this run\n";
+
+	auto newCount = puzzles.size();
+	keptPuzzles.insert(keptPuzzles.end(), puzzles.begin(), puzzles.end());
+	if (!WritePuzzles(filename, keptPuzzles))
+	{
+		std::cerr << "Could not write puzzles to " << filename << "\n";
+		return EXIT_FAILURE;
+	}
+	std::cout << "Wrote " << newCount << " new puzzles to " << filename << ", " << keptPuzzles.size() << " in total\n";
+
+	if (!index.Save())
+	{
+		std::cerr << "Could not write puzzle index to " << indexFilename << "\n";
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,393 @@
+#include "PuzzleCanonicalizer.h"
+#include <algorithm>		// for sort() and min()
+#include <cstring>			// for memcpy()
+#include <limits>
+
+static constexpr auto ORIENTATIONS = 2;
+static constexpr std::int8_t UNASSIGNED = -1;
+static constexpr auto CANDIDATES_RESERVED = 64;
+static constexpr auto IMAGE_SLOT_BITS = 15;			// 12096 ways two rows of a band can relate, a table of 32768 stays sparse
+static constexpr auto VALUE_BITS = 4;
+static constexpr std::uint64_t HASH_SEED_LOW = 0x243F6A8885A308D3ull;
+static constexpr std::uint64_t HASH_SEED_HIGH = 0x13198A2E03707344ull;
+static constexpr std::uint64_t HASH_MULTIPLIER_LOW = 0x9E3779B97F4A7C15ull;
+static constexpr std::uint64_t HASH_MULTIPLIER_HIGH = 0xC2B2AE3D27D4EB4Full;
+
+// Old column -> old column of the first row holding the value the second row has there
+// Columns never map into their own stack, since the rows share a band
+using RowImage = std::array<std::int8_t, BOARD_SIZE>;
+using ColumnOrder = std::array<std::int8_t, BOARD_SIZE>;
+
+// Finalizer from SplitMix64, spreads every input bit over the whole word
+static std::uint64_t MixBits(std::uint64_t value)
+{
+	value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+	value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+	return value ^ (value >> 31);
+}
+
+static void HashBytes(const std::uint8_t* pBytes, int count, PuzzleHash& rHash)
+{
+	for (auto offset = 0; offset < count; offset += static_cast<int>(sizeof(std::uint64_t)))
+	{
+		std::uint64_t word = 0;
+		std::memcpy(&word, pBytes + offset, std::min(static_cast<int>(sizeof(word)), count - offset));
+		rHash.low = MixBits((rHash.low ^ word) * HASH_MULTIPLIER_LOW);
+		rHash.high = MixBits((rHash.high ^ word) * HASH_MULTIPLIER_HIGH);
+	}
+}
+
+// Packs one value per nibble, first one highest, so packed rows compare the same way as the rows
+static std::uint64_t PackRow(const std::array<std::int8_t, BOARD_SIZE>& row)
+{
+	std::uint64_t packed = 0;
+	for (auto value : row) { packed = (packed << VALUE_BITS) | static_cast<std::uint64_t>(value); }
+	return packed;
+}
+
+// Finds the column orders that give the lowest second row for one row image
+// Picks the old column for each new column in turn, keeping only the choices that give the lowest second row value there
+// A second row value refers to a column of the first row, which is placed right away at the lowest position still open to it
+class ColumnOrderSearch
+{
+public:
+	explicit ColumnOrderSearch(const RowImage& image) :
+		m_Image(image),
+		m_ColumnAt(),
+		m_PositionOf(),
+		m_StackAt(),
+		m_StackPositionOf()
+	{
+		m_ColumnAt.fill(UNASSIGNED);
+		m_PositionOf.fill(UNASSIGNED);
+		m_StackAt.fill(UNASSIGNED);
+		m_StackPositionOf.fill(UNASSIGNED);
+		m_LowestRow.fill(BOARD_SIZE);
+		Search(0);
+	}
+
+	const std::array<std::int8_t, BOARD_SIZE>& GetLowestRow() const { return m_LowestRow; }
+	const std::vector<ColumnOrder>& GetOrders() const { return m_Orders; }
+
+private:
+	const RowImage& m_Image;
+	ColumnOrder m_ColumnAt;								// new column -> old column
+	std::array<std::int8_t, BOARD_SIZE> m_PositionOf;	// old column -> new column
+	std::array<std::int8_t, BOX_SIZE> m_StackAt;		// new stack -> old stack
+	std::array<std::int8_t, BOX_SIZE> m_StackPositionOf;	// old stack -> new stack
+	std::array<std::int8_t, BOARD_SIZE> m_LowestRow;
+	std::vector<ColumnOrder> m_Orders;
+
+	void Search(int position)
+	{
+		if (position == BOARD_SIZE)
+		{
+			m_Orders.push_back(m_ColumnAt);
+			return;
+		}
+
+		// Columns that could be placed here
+		std::array<std::int8_t, BOARD_SIZE> options;
+		auto optionCount = 0;
+		auto stack = position / BOX_SIZE;
+		if (m_ColumnAt[position] != UNASSIGNED) { options[optionCount++] = m_ColumnAt[position]; }
+		else if (m_StackAt[stack] != UNASSIGNED)
+		{
+			for (auto column = m_StackAt[stack] * BOX_SIZE; column < (m_StackAt[stack] + 1) * BOX_SIZE; column++)
+				if (m_PositionOf[column] == UNASSIGNED) { options[optionCount++] = static_cast<std::int8_t>(column); }
+		}
+		else
+		{
+			for (auto column = 0; column < BOARD_SIZE; column++)
+				if (m_StackPositionOf[column / BOX_SIZE] == UNASSIGNED) { options[optionCount++] = static_cast<std::int8_t>(column); }
+		}
+
+		std::array<std::int8_t, BOARD_SIZE> values;
+		auto lowest = BOARD_SIZE;
+		for (auto i = 0; i < optionCount; i++)
+		{
+			values[i] = static_cast<std::int8_t>(CalcLowestPosition(m_Image[options[i]], position));
+			lowest = std::min(lowest, static_cast<int>(values[i]));
+		}
+
+		// Worse than the lowest row found so far ? Better ? Then every order found so far is worse
+		if (lowest > m_LowestRow[position]) { return; }
+		if (lowest < m_LowestRow[position])
+		{
+			m_LowestRow[position] = static_cast<std::int8_t>(lowest);
+			for (auto later = position + 1; later < BOARD_SIZE; later++) { m_LowestRow[later] = BOARD_SIZE; }
+			m_Orders.clear();
+		}
+
+		for (auto i = 0; i < optionCount; i++)
+		{
+			if (values[i] != m_LowestRow[position]) { continue; }
+
+			auto column = options[i];
+			auto image = m_Image[column];
+			auto columnAt = m_ColumnAt;
+			auto positionOf = m_PositionOf;
+			auto stackAt = m_StackAt;
+			auto stackPositionOf = m_StackPositionOf;
+
+			if (m_StackAt[stack] == UNASSIGNED)
+			{
+				m_StackAt[stack] = static_cast<std::int8_t>(column / BOX_SIZE);
+				m_StackPositionOf[column / BOX_SIZE] = static_cast<std::int8_t>(stack);
+			}
+			m_ColumnAt[position] = column;
+			m_PositionOf[column] = static_cast<std::int8_t>(position);
+
+			if (m_PositionOf[image] == UNASSIGNED)
+			{
+				if (m_StackAt[values[i] / BOX_SIZE] == UNASSIGNED)
+				{
+					m_StackAt[values[i] / BOX_SIZE] = static_cast<std::int8_t>(image / BOX_SIZE);
+					m_StackPositionOf[image / BOX_SIZE] = static_cast<std::int8_t>(values[i] / BOX_SIZE);
+				}
+				m_ColumnAt[values[i]] = image;
+				m_PositionOf[image] = values[i];
+			}
+
+			Search(position + 1);
+
+			m_ColumnAt = columnAt;
+			m_PositionOf = positionOf;
+			m_StackAt = stackAt;
+			m_StackPositionOf = stackPositionOf;
+		}
+	}
+
+	// Lowest new column the old column could still be given, assuming a column is placed at position
+	int CalcLowestPosition(int column, int position) const
+	{
+		if (m_PositionOf[column] != UNASSIGNED) { return m_PositionOf[column]; }
+
+		// Its stack already has a place ? Then the first open column there
+		auto newStack = m_StackPositionOf[column / BOX_SIZE];
+		if (newStack != UNASSIGNED)
+		{
+			for (auto open = newStack * BOX_SIZE; open < (newStack + 1) * BOX_SIZE; open++)
+				if (m_ColumnAt[open] == UNASSIGNED && open != position) { return open; }
+		}
+
+		// Otherwise the first stack nobody has taken, the current one is taken by the column placed at position
+		for (auto stack = 0; stack < BOX_SIZE; stack++)
+			if (m_StackAt[stack] == UNASSIGNED && stack != position / BOX_SIZE) { return stack * BOX_SIZE; }
+		return BOARD_SIZE;
+	}
+};
+
+// Lowest second row and the column orders giving it, for every row image
+// Open addressing on the packed image, an image never packs to 0 since column 0 cannot map to itself
+class SecondRowTable
+{
+public:
+	struct Entry
+	{
+		std::uint64_t image;
+		std::uint64_t lowestRow;
+		std::uint32_t firstOrder;
+		std::uint32_t orderCount;
+	};
+
+	SecondRowTable() :
+		m_Slots(std::size_t(1) << IMAGE_SLOT_BITS, Entry{ 0, 0, 0, 0 })
+	{
+		RowImage image;
+		std::array<bool, BOARD_SIZE> used{};
+		AddImages(image, used, 0);
+	}
+
+	const Entry& Find(std::uint64_t packedImage) const
+	{
+		auto slot = CalcSlot(packedImage);
+		while (m_Slots[slot].image != packedImage) { slot = (slot + 1) & (m_Slots.size() - 1); }
+		return m_Slots[slot];
+	}
+
+	const ColumnOrder& GetOrder(std::uint32_t index) const { return m_Orders[index]; }
+
+private:
+	std::vector<Entry> m_Slots;
+	std::vector<ColumnOrder> m_Orders;
+
+	static std::size_t CalcSlot(std::uint64_t packedImage)
+	{
+		return static_cast<std::size_t>((packedImage * HASH_MULTIPLIER_LOW) >> (64 - IMAGE_SLOT_BITS));
+	}
+
+	void AddImages(RowImage& rImage, std::array<bool, BOARD_SIZE>& rUsed, int column)
+	{
+		if (column == BOARD_SIZE)
+		{
+			ColumnOrderSearch search(rImage);
+			auto packedImage = PackRow(rImage);
+			auto slot = CalcSlot(packedImage);
+			while (m_Slots[slot].image != 0) { slot = (slot + 1) & (m_Slots.size() - 1); }
+			m_Slots[slot] = { packedImage, PackRow(search.GetLowestRow()), static_cast<std::uint32_t>(m_Orders.size()), static_cast<std::uint32_t>(search.GetOrders().size()) };
+			m_Orders.insert(m_Orders.end(), search.GetOrders().begin(), search.GetOrders().end());
+			return;
+		}
+
+		for (auto target = 0; target < BOARD_SIZE; target++)
+		{
+			if (rUsed[target] || target / BOX_SIZE == column / BOX_SIZE) { continue; }
+			rUsed[target] = true;
+			rImage[column] = static_cast<std::int8_t>(target);
+			AddImages(rImage, rUsed, column + 1);
+			rUsed[target] = false;
+		}
+	}
+};
+
+// Built on first use, a few milliseconds, then shared read-only by every thread
+static const SecondRowTable& GetSecondRowTable()
+{
+	static const SecondRowTable table;
+	return table;
+}
+
+PuzzleCanonicalizer::PuzzleCanonicalizer() :
+	m_Solutions(),
+	m_Givens()
+{
+	m_Candidates.reserve(CANDIDATES_RESERVED);
+}
+
+CanonicalPuzzle PuzzleCanonicalizer::Canonicalize(const Board& board)
+{
+	return Canonicalize(board.GetGivenGrid(), board.GetSolutionGrid());
+}
+
+CanonicalPuzzle PuzzleCanonicalizer::Canonicalize(const SudokuGrid& givens, const SudokuGrid& solution)
+{
+	const auto& table = GetSecondRowTable();
+
+	for (auto row = 0; row < BOARD_SIZE; row++)
+	{
+		for (auto column = 0; column < BOARD_SIZE; column++)
+		{
+			m_Solutions[0][row * BOARD_SIZE + column] = solution[row * BOARD_SIZE + column];
+			m_Solutions[1][row * BOARD_SIZE + column] = solution[column * BOARD_SIZE + row];
+			m_Givens[0][row * BOARD_SIZE + column] = givens[row * BOARD_SIZE + column];
+			m_Givens[1][row * BOARD_SIZE + column] = givens[column * BOARD_SIZE + row];
+		}
+	}
+
+	// The first row always relabels to 1 2 3 ..., so it is the second row that decides between transforms
+	auto lowestRow = std::numeric_limits<std::uint64_t>::max();
+	m_Candidates.clear();
+	for (auto orientation = 0; orientation < ORIENTATIONS; orientation++)
+	{
+		const auto& grid = m_Solutions[orientation];
+		for (auto firstRow = 0; firstRow < BOARD_SIZE; firstRow++)
+		{
+			std::array<std::int8_t, BOARD_SIZE + 1> columnOfValue;
+			for (auto column = 0; column < BOARD_SIZE; column++)
+				columnOfValue[grid[firstRow * BOARD_SIZE + column]] = static_cast<std::int8_t>(column);
+
+			// Either of the other rows in the band can come second
+			auto firstBandRow = (firstRow / BOX_SIZE) * BOX_SIZE;
+			for (auto secondRow = firstBandRow; secondRow < firstBandRow + BOX_SIZE; secondRow++)
+			{
+				if (secondRow == firstRow) { continue; }
+
+				RowImage image;
+				for (auto column = 0; column < BOARD_SIZE; column++)
+					image[column] = columnOfValue[grid[secondRow * BOARD_SIZE + column]];
+
+				const auto& entry = table.Find(PackRow(image));
+				if (entry.lowestRow > lowestRow) { continue; }
+				if (entry.lowestRow < lowestRow)
+				{
+					lowestRow = entry.lowestRow;
+					m_Candidates.clear();
+				}
+				for (auto order = entry.firstOrder; order < entry.firstOrder + entry.orderCount; order++)
+					m_Candidates.push_back({ orientation, firstRow, secondRow, &table.GetOrder(order) });
+			}
+		}
+	}
+
+	// Only a few transforms tie on the second row, build each in full and keep the lowest
+	CanonicalPuzzle canonical;
+	SudokuGrid solutionCandidate;
+	SudokuGrid givensCandidate;
+	for (size_t i = 0; i < m_Candidates.size(); i++)
+	{
+		BuildGrids(m_Candidates[i], solutionCandidate, givensCandidate);
+		if (i == 0 || solutionCandidate < canonical.solution || (solutionCandidate == canonical.solution && givensCandidate < canonical.givens))
+		{
+			canonical.solution = solutionCandidate;
+			canonical.givens = givensCandidate;
+		}
+	}
+
+	canonical.hash = CalcHash(canonical.givens, canonical.solution);
+	return canonical;
+}
+
+void PuzzleCanonicalizer::BuildGrids(const Candidate& candidate, SudokuGrid& rSolution, SudokuGrid& rGivens) const
+{
+	const auto& solution = m_Solutions[candidate.orientation];
+	const auto& givens = m_Givens[candidate.orientation];
+
+	// Relabel so the first row reads 1 2 3 ...
+	std::array<std::uint8_t, BOARD_SIZE + 1> labels;
+	labels[EMPTY_CELL_VALUE] = EMPTY_CELL_VALUE;
+	for (auto column = 0; column < BOARD_SIZE; column++)
+		labels[solution[candidate.firstRow * BOARD_SIZE + (*candidate.pColumns)[column]]] = static_cast<std::uint8_t>(column + 1);
+
+	auto firstValueOf = [&](int row) { return labels[solution[row * BOARD_SIZE + (*candidate.pColumns)[0]]]; };
+
+	// The first band keeps the chosen first and second rows, then the row left over
+	std::array<int, BOARD_SIZE> rowOrder;
+	auto firstBand = candidate.firstRow / BOX_SIZE;
+	rowOrder[0] = candidate.firstRow;
+	rowOrder[1] = candidate.secondRow;
+	for (auto row = firstBand * BOX_SIZE; row < (firstBand + 1) * BOX_SIZE; row++)
+		if (row != candidate.firstRow && row != candidate.secondRow) { rowOrder[2] = row; }
+
+	// Column values never repeat, so the other rows sort by their first value alone
+	auto* pOtherBands = rowOrder.data() + BOX_SIZE;
+	for (auto band = 0, block = 0; band < BOX_SIZE; band++)
+	{
+		if (band == firstBand) { continue; }
+		auto* pRows = pOtherBands + (block++) * BOX_SIZE;
+		for (auto i = 0; i < BOX_SIZE; i++) { pRows[i] = band * BOX_SIZE + i; }
+		std::sort(pRows, pRows + BOX_SIZE, [&](int a, int b) { return firstValueOf(a) < firstValueOf(b); });
+	}
+
+	// Then whole bands by their first row
+	for (auto block = 1; block < BOX_SIZE - 1; block++)
+	{
+		for (auto later = block; later > 0; later--)
+		{
+			auto* pEarlier = pOtherBands + (later - 1) * BOX_SIZE;
+			auto* pLater = pEarlier + BOX_SIZE;
+			if (firstValueOf(pEarlier[0]) < firstValueOf(pLater[0])) { break; }
+			std::swap_ranges(pEarlier, pLater, pLater);
+		}
+	}
+
+	for (auto row = 0; row < BOARD_SIZE; row++)
+	{
+		for (auto column = 0; column < BOARD_SIZE; column++)
+		{
+			auto source = rowOrder[row] * BOARD_SIZE + (*candidate.pColumns)[column];
+			rSolution[row * BOARD_SIZE + column] = labels[solution[source]];
+			rGivens[row * BOARD_SIZE + column] = labels[givens[source]];
+		}
+	}
+}
+
+PuzzleHash PuzzleCanonicalizer::CalcHash(const SudokuGrid& givens, const SudokuGrid& solution)
+{
+	PuzzleHash hash{ HASH_SEED_LOW, HASH_SEED_HIGH };
+	HashBytes(givens.data(), BOARD_CELLS, hash);
+	HashBytes(solution.data(), BOARD_CELLS, hash);
+	// Keep the empty slot value free
+	if (hash.low == 0 && hash.high == 0) { hash.low = 1; }
+	return hash;
+}
\ No newline at end of file
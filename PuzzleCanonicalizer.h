@@ -0,0 +1,60 @@
+#pragma once
+#ifndef PUZZLE_CANONICALIZER_H
+#define PUZZLE_CANONICALIZER_H
+
+#include "Board.h"			// also includes "Board_info.h"
+#include <cstdint>
+#include <vector>
+
+// 128-bit fingerprint of a canonical puzzle, never all zeroes so indexes can use that for empty slots
+struct PuzzleHash
+{
+	std::uint64_t low;
+	std::uint64_t high;
+
+	bool operator==(const PuzzleHash&) const = default;
+};
+
+// Givens and solution of the one representative every symmetric variant of a puzzle maps to
+struct CanonicalPuzzle
+{
+	SudokuGrid givens;
+	SudokuGrid solution;
+	PuzzleHash hash;
+};
+
+// Maps a puzzle to its minimal representative under the symmetries of GridTransform
+// Minimal means the lowest solution grid in row order, ties between automorphisms of the solution go to the lowest givens
+// Once the first two rows are picked the first row always relabels to 1 2 3 ..., and the lowest second row and its column orders
+// are looked up in a table built once for every way two rows of a band can relate, so only a few transforms are built in full
+class PuzzleCanonicalizer
+{
+public:
+	PuzzleCanonicalizer();
+	CanonicalPuzzle Canonicalize(const SudokuGrid& givens, const SudokuGrid& solution);
+	CanonicalPuzzle Canonicalize(const Board& board);
+
+private:
+	// Rows as they are read, either straight or transposed, row-major
+	using OrientedGrid = std::array<std::uint8_t, BOARD_CELLS>;
+	// New column -> old column
+	using ColumnOrder = std::array<std::int8_t, BOARD_SIZE>;
+
+	// A transform that gives the lowest second row seen so far, the other rows follow from it
+	struct Candidate
+	{
+		int orientation;
+		int firstRow;
+		int secondRow;
+		const ColumnOrder* pColumns;
+	};
+
+	std::array<OrientedGrid, 2> m_Solutions;
+	std::array<OrientedGrid, 2> m_Givens;
+	std::vector<Candidate> m_Candidates;
+
+	void BuildGrids(const Candidate& candidate, SudokuGrid& rSolution, SudokuGrid& rGivens) const;
+	static PuzzleHash CalcHash(const SudokuGrid& givens, const SudokuGrid& solution);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,387 @@
+#include "PuzzleGrader.h"
+#include "BoardTopology.h"	// for BOARD_TOPOLOGY
+#include <bit>		// for popcount() and countr_zero()
+
+// Units, peers and box/line intersections, all as row-major grid positions
+static constexpr const auto& TOPOLOGY = BOARD_TOPOLOGY<BOX_SIZE>;
+static constexpr auto INTERSECTION_COUNT = BoardTopology<BOX_SIZE>::INTERSECTION_COUNT;
+static constexpr auto MAX_SUBSET_SIZE = 3;
+
+PuzzleGrader::PuzzleGrader() :
+	m_Candidates(),
+	m_Values(),
+	m_FilledCount(),
+	m_Contradiction()
+{
+}
+
+PuzzleGrade PuzzleGrader::Grade(const SudokuGrid& puzzle)
+{
+	PuzzleGrade grade = { Technique::NONE, 0, false };
+	Load(puzzle);
+
+	while (!m_Contradiction && m_FilledCount < BOARD_CELLS)
+	{
+		// Always go back to the cheapest technique after making progress
+		auto used = Technique::NONE;
+		auto steps = 0;
+		if ((steps = ApplyNakedSingles()) > 0) { used = Technique::NAKED_SINGLE; }
+		else if ((steps = ApplyHiddenSingles()) > 0) { used = Technique::HIDDEN_SINGLE; }
+		else if ((steps = ApplyLockedCandidates()) > 0) { used = Technique::LOCKED_CANDIDATES; }
+		else if ((steps = ApplyNakedSubsets(2)) > 0) { used = Technique::NAKED_PAIR; }
+		else if ((steps = ApplyHiddenSubsets(2)) > 0) { used = Technique::HIDDEN_PAIR; }
+		else if ((steps = ApplyNakedSubsets(3)) > 0) { used = Technique::NAKED_TRIPLE; }
+		else if ((steps = ApplyHiddenSubsets(3)) > 0) { used = Technique::HIDDEN_TRIPLE; }
+		else if ((steps = ApplyXWings()) > 0) { used = Technique::X_WING; }
+
+		// Stuck ?
+		if (used == Technique::NONE) { break; }
+
+		grade.stepCount += steps;
+		if (IsTechniqueHarder(used, grade.hardestTechnique)) { grade.hardestTechnique = used; }
+	}
+
+	grade.solved = !m_Contradiction && m_FilledCount == BOARD_CELLS;
+	return grade;
+}
+
+PuzzleGrade PuzzleGrader::Grade(const Board& board)
+{
+	return Grade(board.GetGivenGrid());
+}
+
+PuzzleHint PuzzleGrader::FindHint(const Board& board)
+{
+	PuzzleHint hint = { NO_HINTED_CELL, EMPTY_CELL_VALUE, Technique::NONE };
+	// Nothing sound follows from clashing guesses
+	if (board.GetConflictingCellCount() > 0) { return hint; }
+
+	m_Values = board.GetGuessGrid();
+	m_FilledCount = 0;
+	m_Contradiction = false;
+	for (auto cell = 0; cell < BOARD_CELLS; cell++)
+	{
+		m_Candidates[cell] = board.GetCellCandidates(Board::CalcIndex(cell / BOARD_SIZE, cell % BOARD_SIZE));
+		if (m_Values[cell] != EMPTY_CELL_VALUE) { m_FilledCount++; }
+		// Empty cell with nothing left to place ?
+		else if (m_Candidates[cell] == NO_CANDIDATES) { m_Contradiction = true; }
+	}
+
+	auto hardest = Technique::NONE;
+	while (!m_Contradiction && m_FilledCount < BOARD_CELLS)
+	{
+		if (FindNakedSingle(hint) || FindHiddenSingle(hint))
+		{
+			if (IsTechniqueHarder(hardest, hint.technique)) { hint.technique = hardest; }
+			hint.cellIndex = Board::CalcIndex(hint.cellIndex / BOARD_SIZE, hint.cellIndex % BOARD_SIZE);
+			return hint;
+		}
+
+		// No single yet, narrow the candidates with the cheapest technique that can and look again
+		auto used = Technique::NONE;
+		if (ApplyLockedCandidates() > 0) { used = Technique::LOCKED_CANDIDATES; }
+		else if (ApplyNakedSubsets(2) > 0) { used = Technique::NAKED_PAIR; }
+		else if (ApplyHiddenSubsets(2) > 0) { used = Technique::HIDDEN_PAIR; }
+		else if (ApplyNakedSubsets(3) > 0) { used = Technique::NAKED_TRIPLE; }
+		else if (ApplyHiddenSubsets(3) > 0) { used = Technique::HIDDEN_TRIPLE; }
+		else if (ApplyXWings() > 0) { used = Technique::X_WING; }
+
+		// Stuck ?
+		if (used == Technique::NONE) { break; }
+		if (IsTechniqueHarder(used, hardest)) { hardest = used; }
+	}
+
+	return { NO_HINTED_CELL, EMPTY_CELL_VALUE, Technique::NONE };
+}
+
+void PuzzleGrader::Load(const SudokuGrid& puzzle)
+{
+	m_Candidates.fill(ALL_CANDIDATES);
+	m_Values.fill(EMPTY_CELL_VALUE);
+	m_FilledCount = 0;
+	m_Contradiction = false;
+
+	for (auto cell = 0; cell < BOARD_CELLS; cell++)
+	{
+		if (puzzle[cell] == EMPTY_CELL_VALUE) { continue; }
+		// Given clashes with an earlier one ?
+		if ((m_Candidates[cell] & GetCandidateBit(puzzle[cell])) == NO_CANDIDATES) { m_Contradiction = true; }
+		Place(cell, puzzle[cell]);
+	}
+}
+
+void PuzzleGrader::Place(int cell, int value)
+{
+	auto bit = GetCandidateBit(value);
+	m_Values[cell] = static_cast<std::uint8_t>(value);
+	m_Candidates[cell] = NO_CANDIDATES;
+	m_FilledCount++;
+
+	for (auto peer : TOPOLOGY.peers[cell])
+		if (m_Values[peer] == EMPTY_CELL_VALUE) { Eliminate(peer, bit); }
+}
+
+// Returns true if any candidates were removed
+bool PuzzleGrader::Eliminate(int cell, CandidateMask mask)
+{
+	if ((m_Candidates[cell] & mask) == NO_CANDIDATES) { return false; }
+
+	m_Candidates[cell] &= ~mask;
+	// Empty cell left with nothing to place ?
+	if (m_Candidates[cell] == NO_CANDIDATES) { m_Contradiction = true; }
+	return true;
+}
+
+int PuzzleGrader::ApplyNakedSingles()
+{
+	auto steps = 0;
+
+	for (auto cell = 0; cell < BOARD_CELLS && !m_Contradiction; cell++)
+	{
+		auto candidates = m_Candidates[cell];
+		// Only one candidate left ?
+		if (m_Values[cell] == EMPTY_CELL_VALUE && std::popcount(candidates) == 1)
+		{
+			Place(cell, std::countr_zero(candidates) + 1);
+			steps++;
+		}
+	}
+
+	return steps;
+}
+
+int PuzzleGrader::ApplyHiddenSingles()
+{
+	auto steps = 0;
+
+	for (auto& unit : TOPOLOGY.units)
+	{
+		// Find values with exactly one possible cell in this unit
+		CandidateMask once = NO_CANDIDATES, twice = NO_CANDIDATES, placed = NO_CANDIDATES;
+		for (auto cell : unit)
+		{
+			twice |= once & m_Candidates[cell];
+			once |= m_Candidates[cell];
+			if (m_Values[cell] != EMPTY_CELL_VALUE) { placed |= GetCandidateBit(m_Values[cell]); }
+		}
+
+		// Value that has nowhere to go ?
+		if ((once | placed) != ALL_CANDIDATES) { m_Contradiction = true; }
+		if (m_Contradiction) { break; }
+
+		for (auto singles = static_cast<CandidateMask>(once & ~twice); singles != NO_CANDIDATES; singles &= singles - 1)
+		{
+			auto bit = static_cast<CandidateMask>(singles & -singles);
+			for (auto cell : unit)
+			{
+				// Still a candidate ? An earlier placement may have removed it
+				if (m_Candidates[cell] & bit)
+				{
+					Place(cell, std::countr_zero(bit) + 1);
+					steps++;
+					break;
+				}
+			}
+		}
+	}
+
+	return steps;
+}
+
+int PuzzleGrader::ApplyLockedCandidates()
+{
+	auto steps = 0;
+
+	for (auto i = 0; i < INTERSECTION_COUNT && !m_Contradiction; i++)
+	{
+		CandidateMask shared = NO_CANDIDATES, boxRest = NO_CANDIDATES, lineRest = NO_CANDIDATES;
+		for (auto cell : TOPOLOGY.intersections[i]) { shared |= m_Candidates[cell]; }
+		for (auto cell : TOPOLOGY.intersectionBoxRests[i]) { boxRest |= m_Candidates[cell]; }
+		for (auto cell : TOPOLOGY.intersectionLineRests[i]) { lineRest |= m_Candidates[cell]; }
+
+		// Pointing: values confined to the intersection within the box are removed from the rest of the line
+		auto pointing = static_cast<CandidateMask>(shared & ~boxRest & lineRest);
+		// Claiming: values confined to the intersection within the line are removed from the rest of the box
+		auto claiming = static_cast<CandidateMask>(shared & ~lineRest & boxRest);
+
+		auto progress = false;
+		if (pointing != NO_CANDIDATES)
+			for (auto cell : TOPOLOGY.intersectionLineRests[i]) { progress |= Eliminate(cell, pointing); }
+		if (claiming != NO_CANDIDATES)
+			for (auto cell : TOPOLOGY.intersectionBoxRests[i]) { progress |= Eliminate(cell, claiming); }
+		if (progress) { steps++; }
+	}
+
+	return steps;
+}
+
+// Naked pairs/triples: a group of cells that together only allow as many values as there are cells
+int PuzzleGrader::ApplyNakedSubsets(int size)
+{
+	auto steps = 0;
+
+	for (auto& unit : TOPOLOGY.units)
+	{
+		// Only cells with 2 to size candidates can be part of the subset
+		std::array<int, BOARD_SIZE> cells;
+		auto count = 0;
+		for (auto cell : unit)
+		{
+			auto candidateCount = std::popcount(m_Candidates[cell]);
+			if (candidateCount >= 2 && candidateCount <= size) { cells[count++] = cell; }
+		}
+
+		for (auto a = 0; a < count; a++)
+		{
+			for (auto b = a + 1; b < count; b++)
+			{
+				// Pairs run the innermost loop once and ignore c
+				for (auto c = (size == MAX_SUBSET_SIZE ? b + 1 : count - 1); c < count; c++)
+				{
+					auto combined = static_cast<CandidateMask>(m_Candidates[cells[a]] | m_Candidates[cells[b]] | (size == MAX_SUBSET_SIZE ? m_Candidates[cells[c]] : NO_CANDIDATES));
+					if (std::popcount(combined) != size) { continue; }
+
+					auto progress = false;
+					for (auto cell : unit)
+					{
+						auto inSubset = cell == cells[a] || cell == cells[b] || (size == MAX_SUBSET_SIZE && cell == cells[c]);
+						if (!inSubset && m_Values[cell] == EMPTY_CELL_VALUE) { progress |= Eliminate(cell, combined); }
+					}
+					if (progress) { steps++; }
+				}
+			}
+		}
+	}
+
+	return steps;
+}
+
+// Hidden pairs/triples: as many values as cells that can only go in that group of cells
+int PuzzleGrader::ApplyHiddenSubsets(int size)
+{
+	auto steps = 0;
+
+	for (auto& unit : TOPOLOGY.units)
+	{
+		// Positions within the unit where each value can go
+		std::array<std::uint16_t, BOARD_SIZE> positions{};
+		for (auto i = 0; i < BOARD_SIZE; i++)
+			for (auto value = 0; value < BOARD_SIZE; value++)
+				if (m_Candidates[unit[i]] & (1 << value)) { positions[value] |= static_cast<std::uint16_t>(1 << i); }
+
+		// Only values with 2 to size positions can be part of the subset
+		std::array<int, BOARD_SIZE> values;
+		auto count = 0;
+		for (auto value = 0; value < BOARD_SIZE; value++)
+		{
+			auto positionCount = std::popcount(positions[value]);
+			if (positionCount >= 2 && positionCount <= size) { values[count++] = value; }
+		}
+
+		for (auto a = 0; a < count; a++)
+		{
+			for (auto b = a + 1; b < count; b++)
+			{
+				// Pairs run the innermost loop once and ignore c
+				for (auto c = (size == MAX_SUBSET_SIZE ? b + 1 : count - 1); c < count; c++)
+				{
+					auto combined = positions[values[a]] | positions[values[b]] | (size == MAX_SUBSET_SIZE ? positions[values[c]] : 0);
+					if (std::popcount(static_cast<std::uint16_t>(combined)) != size) { continue; }
+
+					// Remove every other value from those cells
+					auto keep = static_cast<CandidateMask>((1 << values[a]) | (1 << values[b]) | (size == MAX_SUBSET_SIZE ? (1 << values[c]) : 0));
+					auto progress = false;
+					for (auto i = 0; i < BOARD_SIZE; i++)
+						if (combined & (1 << i)) { progress |= Eliminate(unit[i], static_cast<CandidateMask>(ALL_CANDIDATES & ~keep)); }
+					if (progress) { steps++; }
+				}
+			}
+		}
+	}
+
+	return steps;
+}
+
+// A value limited to the same two columns in two rows can be removed from the rest of those columns (and vice versa)
+int PuzzleGrader::ApplyXWings()
+{
+	auto steps = 0;
+
+	for (auto value = 0; value < BOARD_SIZE; value++)
+	{
+		auto bit = static_cast<CandidateMask>(1 << value);
+
+		for (auto byColumn = 0; byColumn < 2; byColumn++)
+		{
+			// Positions of the value along each line
+			std::array<std::uint16_t, BOARD_SIZE> positions{};
+			for (auto line = 0; line < BOARD_SIZE; line++)
+				for (auto i = 0; i < BOARD_SIZE; i++)
+					if (m_Candidates[TOPOLOGY.units[byColumn * BOARD_SIZE + line][i]] & bit) { positions[line] |= static_cast<std::uint16_t>(1 << i); }
+
+			for (auto a = 0; a < BOARD_SIZE; a++)
+			{
+				if (std::popcount(positions[a]) != 2) { continue; }
+				for (auto b = a + 1; b < BOARD_SIZE; b++)
+				{
+					if (positions[b] != positions[a]) { continue; }
+
+					// Remove the value from the crossing lines, except in the two wing lines
+					auto progress = false;
+					for (auto cross = 0; cross < BOARD_SIZE; cross++)
+					{
+						if ((positions[a] & (1 << cross)) == 0) { continue; }
+						for (auto line = 0; line < BOARD_SIZE; line++)
+							if (line != a && line != b) { progress |= Eliminate(TOPOLOGY.units[(1 - byColumn) * BOARD_SIZE + cross][line], bit); }
+					}
+					if (progress) { steps++; }
+				}
+			}
+		}
+	}
+
+	return steps;
+}
+
+bool PuzzleGrader::FindNakedSingle(PuzzleHint& rHint) const
+{
+	for (auto cell = 0; cell < BOARD_CELLS; cell++)
+	{
+		if (m_Values[cell] == EMPTY_CELL_VALUE && std::popcount(m_Candidates[cell]) == 1)
+		{
+			rHint = { cell, std::countr_zero(m_Candidates[cell]) + 1, Technique::NAKED_SINGLE };
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool PuzzleGrader::FindHiddenSingle(PuzzleHint& rHint) const
+{
+	for (auto& unit : TOPOLOGY.units)
+	{
+		// Placed values have no candidates left, so only open values can show up once
+		CandidateMask once = NO_CANDIDATES, twice = NO_CANDIDATES;
+		for (auto cell : unit)
+		{
+			twice |= once & m_Candidates[cell];
+			once |= m_Candidates[cell];
+		}
+
+		auto singles = static_cast<CandidateMask>(once & ~twice);
+		if (singles == NO_CANDIDATES) { continue; }
+
+		auto bit = static_cast<CandidateMask>(singles & -singles);
+		for (auto cell : unit)
+		{
+			if (m_Candidates[cell] & bit)
+			{
+				rHint = { cell, std::countr_zero(bit) + 1, Technique::HIDDEN_SINGLE };
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
\ No newline at end of file
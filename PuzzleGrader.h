@@ -0,0 +1,54 @@
+#pragma once
+#ifndef PUZZLE_GRADER_H
+#define PUZZLE_GRADER_H
+
+#include "Board.h"			// also includes "Board_info.h" and "Cell.h"
+#include "Technique.h"
+
+struct PuzzleGrade
+{
+	Technique hardestTechnique;
+	int stepCount;
+	bool solved;	// false if the puzzle needs techniques harder than X_WING (or has no solution)
+};
+
+struct PuzzleHint
+{
+	int cellIndex;			// as indexed by Board, NO_HINTED_CELL if nothing can be deduced
+	int value;
+	Technique technique;	// hardest technique needed to get there
+};
+
+// Rates a puzzle by solving it with human techniques only, always trying the cheapest technique first
+class PuzzleGrader
+{
+public:
+	PuzzleGrader();
+	PuzzleGrade Grade(const SudokuGrid& puzzle);
+	PuzzleGrade Grade(const Board& board);
+	// Next cell that follows logically from what the player has entered so far, right or wrong
+	// Starts from the candidates the board keeps up to date, so most hints are a single scan
+	PuzzleHint FindHint(const Board& board);
+
+private:
+	std::array<CandidateMask, BOARD_CELLS> m_Candidates;
+	SudokuGrid m_Values;
+	int m_FilledCount;
+	bool m_Contradiction;
+
+	void Load(const SudokuGrid& puzzle);
+	void Place(int cell, int value);
+	bool Eliminate(int cell, CandidateMask mask);
+	// Each returns the amount of steps taken, 0 if the technique could not be applied
+	int ApplyNakedSingles();
+	int ApplyHiddenSingles();
+	int ApplyLockedCandidates();
+	int ApplyNakedSubsets(int size);
+	int ApplyHiddenSubsets(int size);
+	int ApplyXWings();
+	// Like the Apply functions for singles, but only report the first one found
+	bool FindNakedSingle(PuzzleHint& rHint) const;
+	bool FindHiddenSingle(PuzzleHint& rHint) const;
+};
+
+#endif
\ No newline at end of file
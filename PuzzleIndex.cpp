@@ -0,0 +1,116 @@
+#include "PuzzleIndex.h"
+#include "ErrorLogging.h"		// for Assert()
+#include <algorithm>			// for count_if()
+#include <cstring>				// for memcmp() and memcpy()
+#include <fstream>				// for ifstream, ofstream
+
+static constexpr char INDEX_MAGIC[4] = { 'S', 'D', 'K', 'I' };
+static constexpr auto INDEX_VERSION = 1u;
+static constexpr auto INITIAL_CAPACITY = 1024u;
+// Grows once more than half of the slots are taken, which keeps probe runs short
+static constexpr auto MAX_LOAD_DIVISOR = 2;
+static constexpr PuzzleHash EMPTY_SLOT{ 0, 0 };
+
+static constexpr auto ERROR_EMPTY_HASH = "PuzzleIndex::Insert(hash): the all zero hash marks empty slots and cannot be inserted";
+
+static bool IsPowerOfTwo(std::uint32_t value)
+{
+	return value != 0 && (value & (value - 1)) == 0;
+}
+
+PuzzleIndex::PuzzleIndex() :
+	m_Slots(INITIAL_CAPACITY, EMPTY_SLOT),
+	m_Count()
+{
+}
+
+bool PuzzleIndex::Open(const std::string& filename)
+{
+	m_Filename = filename;
+	Clear();
+
+	std::ifstream file(filename, std::ios_base::binary);
+	if (!file.is_open()) { return true; }
+
+	Header header;
+	if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))) { return false; }
+	if (std::memcmp(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0 || header.version != INDEX_VERSION
+		|| !IsPowerOfTwo(header.capacity) || header.count > header.capacity / MAX_LOAD_DIVISOR) { return false; }
+
+	// Checked before allocating, so a damaged capacity cannot ask for gigabytes
+	auto slotsStart = file.tellg();
+	file.seekg(0, std::ios_base::end);
+	auto slotsSize = static_cast<std::uint64_t>(file.tellg() - slotsStart);
+	if (!file || slotsSize != static_cast<std::uint64_t>(header.capacity) * sizeof(PuzzleHash)) { return false; }
+	file.seekg(slotsStart);
+
+	std::vector<PuzzleHash> slots(header.capacity);
+	if (!file.read(reinterpret_cast<char*>(slots.data()), slots.size() * sizeof(PuzzleHash))) { return false; }
+	auto occupiedCount = std::count_if(slots.begin(), slots.end(), [](const PuzzleHash& hash) { return !(hash == EMPTY_SLOT); });
+	if (occupiedCount != static_cast<std::ptrdiff_t>(header.count)) { return false; }
+
+	m_Slots = std::move(slots);
+	m_Count = static_cast<int>(header.count);
+	return true;
+}
+
+void PuzzleIndex::Clear()
+{
+	m_Slots.assign(INITIAL_CAPACITY, EMPTY_SLOT);
+	m_Count = 0;
+}
+
+bool PuzzleIndex::Save() const
+{
+	Header header;
+	std::memcpy(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC));
+	header.version = INDEX_VERSION;
+	header.capacity = static_cast<std::uint32_t>(m_Slots.size());
+	header.count = static_cast<std::uint32_t>(m_Count);
+
+	std::ofstream file(m_Filename, std::ios_base::binary);
+	if (!file.is_open()) { return false; }
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	file.write(reinterpret_cast<const char*>(m_Slots.data()), m_Slots.size() * sizeof(PuzzleHash));
+	return file.good();
+}
+
+bool PuzzleIndex::Insert(const PuzzleHash& hash)
+{
+	Assert(ERROR_EMPTY_HASH, !(hash == EMPTY_SLOT));
+
+	auto slot = FindSlot(hash);
+	if (m_Slots[slot] == hash) { return false; }
+
+	m_Slots[slot] = hash;
+	if (++m_Count > static_cast<int>(m_Slots.size() / MAX_LOAD_DIVISOR)) { Grow(); }
+	return true;
+}
+
+bool PuzzleIndex::Contains(const PuzzleHash& hash) const
+{
+	return m_Slots[FindSlot(hash)] == hash;
+}
+
+int PuzzleIndex::GetCount() const
+{
+	return m_Count;
+}
+
+// Returns the slot holding the hash, or the empty slot it would go in
+std::size_t PuzzleIndex::FindSlot(const PuzzleHash& hash) const
+{
+	auto mask = m_Slots.size() - 1;
+	auto slot = static_cast<std::size_t>(hash.low) & mask;
+	while (!(m_Slots[slot] == hash) && !(m_Slots[slot] == EMPTY_SLOT)) { slot = (slot + 1) & mask; }
+	return slot;
+}
+
+void PuzzleIndex::Grow()
+{
+	std::vector<PuzzleHash> oldSlots(m_Slots.size() * 2, EMPTY_SLOT);
+	m_Slots.swap(oldSlots);
+
+	for (const auto& hash : oldSlots)
+		if (!(hash == EMPTY_SLOT)) { m_Slots[FindSlot(hash)] = hash; }
+}
\ No newline at end of file
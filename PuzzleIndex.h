@@ -0,0 +1,48 @@
+#pragma once
+#ifndef PUZZLE_INDEX_H
+#define PUZZLE_INDEX_H
+
+#include "PuzzleCanonicalizer.h"	// for PuzzleHash
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Set of canonical puzzle hashes kept on disk, so puzzles generated by earlier runs are recognized
+// Layout: header, then the slots of an open-addressing table with linear probing, an all zero slot is empty
+// The slots are written as they are in memory, so loading is a single read with no rehashing
+class PuzzleIndex
+{
+public:
+	static constexpr auto FILE_EXTENSION = ".index";
+
+	PuzzleIndex();
+	// A missing file gives an empty index, returns false if the file is not an index, its size does not match its capacity or its count does not match its slots
+	bool Open(const std::string& filename);
+	// Empties the index, it still saves to the file given to Open()
+	void Clear();
+	// Writes back to the file given to Open()
+	bool Save() const;
+	// Returns false if the hash was already there
+	bool Insert(const PuzzleHash& hash);
+	bool Contains(const PuzzleHash& hash) const;
+	int GetCount() const;
+
+private:
+	struct Header
+	{
+		char magic[4];
+		std::uint32_t version;
+		std::uint32_t capacity;
+		std::uint32_t count;
+	};
+
+	std::string m_Filename;
+	std::vector<PuzzleHash> m_Slots;
+	int m_Count;
+
+	// Capacity is a power of two, so the low bits of the hash pick the first slot
+	std::size_t FindSlot(const PuzzleHash& hash) const;
+	void Grow();
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,165 @@
+#include "PuzzlePool.h"
+#include "PuzzleGrader.h"
+#include "Level_info.h"			// for GetFirstLevel(), GetNumberOfLevels() and GetAmountOfNumbersToHide()
+#include "Difficulty_info.h"	// for GetNumberOfDifficulties(), ValidateDifficulty(), GetMinTechnique() and GetMaxTechnique()
+#include "SeedSolutions_info.h"	// for GetRandomSeedSolution()
+#include "Random.h"				// for GetRandomSeed(), DeriveRandomSeed() and ScopedRandomSeed
+#include <algorithm>			// for max()
+#include <chrono>				// for milliseconds
+
+static constexpr auto WORKER_IDLE_SLEEP = std::chrono::milliseconds(50);
+static constexpr auto MAX_GRADING_ATTEMPTS = 10;
+static constexpr auto POOL_SEED_INDEX = 1;
+
+PuzzlePool::PuzzlePool() :
+	m_QueueCount(GetNumberOfDifficulties() * GetNumberOfLevels()),
+	m_HitCount(),
+	m_MissCount(),
+	// Derived from the constructing thread's seed so a replayed session generates the same boards
+	m_Seed(DeriveRandomSeed(GetRandomSeed(), POOL_SEED_INDEX))
+{
+	mp_Queues = std::make_unique<BoardQueue[]>(m_QueueCount);
+}
+
+PuzzlePool::~PuzzlePool()
+{
+	Stop();
+}
+
+void PuzzlePool::Start()
+{
+	if (!m_Worker.joinable()) { m_Worker = std::jthread([this](std::stop_token stopToken) { FillQueues(stopToken); }); }
+}
+
+void PuzzlePool::Stop()
+{
+	if (m_Worker.joinable())
+	{
+		m_Worker.request_stop();
+		m_Worker.join();
+	}
+}
+
+void PuzzlePool::TakeBoard(Board& rBoard, int difficulty, int level)
+{
+	auto& queue = GetQueue(difficulty, level);
+	auto sequence = queue.takenCount.load(std::memory_order_relaxed);
+	auto head = queue.head.load(std::memory_order_relaxed);
+	auto tail = queue.tail.load(std::memory_order_acquire);
+
+	// Drop boards the worker finished after a miss already generated them
+	while (head != tail && queue.sequences[head] < sequence) { head = NextSlot(head); }
+
+	// Not ready ? Generate the same board on this thread instead
+	if (head == tail || queue.sequences[head] != sequence)
+	{
+		m_MissCount++;
+		GenerateSequencedBoard(rBoard, difficulty, level, sequence);
+	}
+	else
+	{
+		m_HitCount++;
+		rBoard = queue.boards[head];
+		head = NextSlot(head);
+	}
+
+	// Hand the slots back to the worker
+	queue.head.store(head, std::memory_order_release);
+	queue.takenCount.store(sequence + 1, std::memory_order_release);
+}
+
+int PuzzlePool::GetQueueDepth(int difficulty, int level) const
+{
+	auto& queue = GetQueue(difficulty, level);
+	return (queue.tail.load(std::memory_order_acquire) - queue.head.load(std::memory_order_acquire) + QUEUE_SLOTS) % QUEUE_SLOTS;
+}
+
+int PuzzlePool::GetHitCount() const
+{
+	return m_HitCount;
+}
+
+int PuzzlePool::GetMissCount() const
+{
+	return m_MissCount;
+}
+
+float PuzzlePool::GetMissRate() const
+{
+	auto taken = m_HitCount + m_MissCount;
+	return (taken == 0) ? 0.0f : static_cast<float>(m_MissCount) / taken;
+}
+
+void PuzzlePool::GenerateBoard(Board& rBoard, int difficulty, int level)
+{
+	static thread_local PuzzleGrader grader;
+
+	for (auto attempt = 1; attempt <= MAX_GRADING_ATTEMPTS; attempt++)
+	{
+		// Transforming a seed grid takes the same short time every call, unlike filling a board by backtracking
+		// Generate again in the rare case the sudoku cannot keep a unique solution with that many hidden cells
+		do { rBoard.GenerateNewSudoku(GetRandomSeedSolution()); }
+		while (!rBoard.HideCells(GetAmountOfNumbersToHide(difficulty, level)));
+
+		// Solvable within the difficulty's technique band ? Otherwise keep the last attempt so generation time stays bounded
+		auto grade = grader.Grade(rBoard);
+		if (grade.solved && !IsTechniqueHarder(GetMinTechnique(difficulty), grade.hardestTechnique)
+			&& !IsTechniqueHarder(grade.hardestTechnique, GetMaxTechnique(difficulty))) { break; }
+	}
+}
+
+int PuzzlePool::NextSlot(int slot)
+{
+	return (slot + 1) % QUEUE_SLOTS;
+}
+
+// Queues are keyed the same way as GetAmountOfNumbersToHide()
+int PuzzlePool::GetQueueIndex(int difficulty, int level)
+{
+	ValidateDifficulty(difficulty);
+	ValidateLevel(level);
+	return difficulty * GetNumberOfLevels() + (level - GetFirstLevel());
+}
+
+PuzzlePool::BoardQueue& PuzzlePool::GetQueue(int difficulty, int level) const
+{
+	return mp_Queues[GetQueueIndex(difficulty, level)];
+}
+
+// Generation only draws from the board stream, so seeding it alone makes the board depend on nothing but the sequence
+void PuzzlePool::GenerateSequencedBoard(Board& rBoard, int difficulty, int level, int sequence) const
+{
+	ScopedRandomSeed boardSeed(RandomStream::BOARD, DeriveRandomSeed(DeriveRandomSeed(m_Seed, GetQueueIndex(difficulty, level)), sequence));
+	GenerateBoard(rBoard, difficulty, level);
+}
+
+void PuzzlePool::FillQueues(std::stop_token stopToken)
+{
+	while (!stopToken.stop_requested())
+	{
+		auto generated = false;
+
+		for (auto difficulty = 0; difficulty < GetNumberOfDifficulties() && !stopToken.stop_requested(); difficulty++)
+		{
+			for (auto level = GetFirstLevel(); level < GetFirstLevel() + GetNumberOfLevels() && !stopToken.stop_requested(); level++)
+			{
+				auto& queue = GetQueue(difficulty, level);
+				auto tail = queue.tail.load(std::memory_order_relaxed);
+
+				// Room for another board ? Only fill one per queue each pass so all queues fill up evenly
+				if (NextSlot(tail) != queue.head.load(std::memory_order_acquire))
+				{
+					// Boards already generated on a miss are skipped
+					queue.nextSequence = std::max(queue.nextSequence, queue.takenCount.load(std::memory_order_acquire));
+					GenerateSequencedBoard(queue.boards[tail], difficulty, level, queue.nextSequence);
+					queue.sequences[tail] = queue.nextSequence++;
+					queue.tail.store(NextSlot(tail), std::memory_order_release);
+					generated = true;
+				}
+			}
+		}
+
+		// All queues full ? Wait for boards to be taken
+		if (!generated) { std::this_thread::sleep_for(WORKER_IDLE_SLEEP); }
+	}
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+#ifndef PUZZLE_POOL_H
+#define PUZZLE_POOL_H
+
+#include "Board.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+
+// Keeps a few ready-made boards for every difficulty and level, generated on a worker thread
+// The n-th board taken for a difficulty and level is generated from its own seed, derived from the seed of the thread
+// that made the pool, so a replayed session gets the same boards whether they were ready in time or not
+class PuzzlePool
+{
+public:
+	PuzzlePool();
+	~PuzzlePool();
+	void Start();
+	void Stop();
+	// Copies a ready board into rBoard, only generates one on the calling thread if it is not ready
+	void TakeBoard(Board& rBoard, int difficulty, int level);
+	int GetQueueDepth(int difficulty, int level) const;
+	int GetHitCount() const;
+	int GetMissCount() const;
+	float GetMissRate() const;
+	static void GenerateBoard(Board& rBoard, int difficulty, int level);
+
+	PuzzlePool(PuzzlePool&&) = delete;					// move ctor
+	PuzzlePool(PuzzlePool const&) = delete;				// copy ctor
+	void operator=(PuzzlePool&&) = delete;				// move assignment
+	void operator=(PuzzlePool const&) = delete;			// copy assignment
+
+private:
+	static constexpr auto QUEUE_CAPACITY = 2;
+	static constexpr auto QUEUE_SLOTS = QUEUE_CAPACITY + 1;
+
+	// Lock-free ring buffer with a single producer (worker) and a single consumer (TakeBoard caller)
+	// One slot is always left empty to tell a full queue from an empty one
+	struct BoardQueue
+	{
+		std::array<Board, QUEUE_SLOTS> boards;
+		// Which board of the queue's sequence each slot holds
+		std::array<int, QUEUE_SLOTS> sequences{};
+		std::atomic<int> head{ 0 };
+		std::atomic<int> tail{ 0 };
+		// The next board taken is always this one of the sequence, a board generated on a miss is not made again
+		std::atomic<int> takenCount{ 0 };
+		// Only used by the worker
+		int nextSequence = 0;
+	};
+
+	std::unique_ptr<BoardQueue[]> mp_Queues;
+	int m_QueueCount;
+	int m_HitCount;
+	int m_MissCount;
+	std::uint64_t m_Seed;
+	std::jthread m_Worker;
+
+	static int NextSlot(int slot);
+	static int GetQueueIndex(int difficulty, int level);
+	BoardQueue& GetQueue(int difficulty, int level) const;
+	void GenerateSequencedBoard(Board& rBoard, int difficulty, int level, int sequence) const;
+	void FillQueues(std::stop_token stopToken);
+};
+
+#endif
\ No newline at end of file
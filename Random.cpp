@@ -2,27 +2,175 @@
 #include "ErrorLogging.h"	// for Assert()
 
 static constexpr auto MAX_ROTATION_DEGREES = 360.0f;
+static constexpr auto RANDOM_STREAM_COUNT = static_cast<int>(RandomStream::COLLISIONS) + 1;
+static constexpr std::uint64_t DEFAULT_RANDOM_SEED = 1;
+static constexpr std::uint64_t GOLDEN_GAMMA = 0x9E3779B97F4A7C15ull;
 static constexpr auto ERROR_MULTIPLE_OUT_OF_RANGE = "Angle multiple out of range - value must be between 1.0f and 360.0f.";
+static constexpr auto ERROR_RANDOM_RANGE_EMPTY = "Random number range is empty - min must be <= max.";
 
-bool GetRandomBool()
+// SplitMix64 step, turns any seed (even 0 or nearby seeds) into well mixed state words
+static std::uint64_t MixSeed(std::uint64_t& rSeed)
 {
-	return static_cast<bool>(rand() % 2);
+	auto z = (rSeed += GOLDEN_GAMMA);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
 }
 
-Direction GetRandomDirection()
+// xoshiro256** (Blackman and Vigna), a handful of shifts and rotates per number with a 2^256 - 1 period
+class RandomEngine
 {
-	return static_cast<Direction>(rand() % GetNumberOfDirections());
+public:
+	explicit RandomEngine(std::uint64_t seed = DEFAULT_RANDOM_SEED)
+	{
+		Seed(seed);
+	}
+
+	void Seed(std::uint64_t seed)
+	{
+		for (auto& word : m_State) { word = MixSeed(seed); }
+	}
+
+	const std::array<std::uint64_t, 4>& GetState() const
+	{
+		return m_State;
+	}
+
+	void SetState(const std::array<std::uint64_t, 4>& state)
+	{
+		m_State = state;
+	}
+
+	std::uint64_t Next()
+	{
+		auto result = Rotate(m_State[1] * 5, 7) * 9;
+		auto shifted = m_State[1] << 17;
+		m_State[2] ^= m_State[0];
+		m_State[3] ^= m_State[1];
+		m_State[1] ^= m_State[2];
+		m_State[0] ^= m_State[3];
+		m_State[2] ^= shifted;
+		m_State[3] = Rotate(m_State[3], 45);
+		return result;
+	}
+
+	// Lemire's multiply and shift reduction, only divides when a draw lands in the small biased part of the range
+	std::uint32_t NextBelow(std::uint32_t range)
+	{
+		auto product = static_cast<std::uint64_t>(NextWord()) * range;
+		auto low = static_cast<std::uint32_t>(product);
+		if (low < range)
+		{
+			auto threshold = (0u - range) % range;
+			while (low < threshold)
+			{
+				product = static_cast<std::uint64_t>(NextWord()) * range;
+				low = static_cast<std::uint32_t>(product);
+			}
+		}
+		return static_cast<std::uint32_t>(product >> 32);
+	}
+
+private:
+	std::array<std::uint64_t, 4> m_State;
+
+	static std::uint64_t Rotate(std::uint64_t value, int bits)
+	{
+		return (value << bits) | (value >> (64 - bits));
+	}
+
+	// The upper bits are the strongest
+	std::uint32_t NextWord()
+	{
+		return static_cast<std::uint32_t>(Next() >> 32);
+	}
+};
+
+struct RandomStreams
+{
+	std::uint64_t seed = DEFAULT_RANDOM_SEED;
+	std::array<RandomEngine, RANDOM_STREAM_COUNT> engines;
+
+	RandomStreams()
+	{
+		SeedAll(DEFAULT_RANDOM_SEED);
+	}
+
+	void SeedAll(std::uint64_t newSeed)
+	{
+		seed = newSeed;
+		for (auto stream = 0; stream < RANDOM_STREAM_COUNT; stream++) { engines[stream].Seed(DeriveRandomSeed(newSeed, stream)); }
+	}
+};
+
+// One set per thread, so generator threads never contend with the game or each other
+static RandomStreams& GetStreams()
+{
+	static thread_local RandomStreams streams;
+	return streams;
+}
+
+static RandomEngine& GetEngine(RandomStream stream)
+{
+	return GetStreams().engines[static_cast<int>(stream)];
 }
 
-int GetRandomNumberBetween(int min, int max)
+void SeedRandomStreams(std::uint64_t seed)
 {
-	return min + rand() % (max - min + 1);
+	GetStreams().SeedAll(seed);
 }
 
-float GetRandomAngleOfMultiple(float multiple)
+void SeedRandomStream(RandomStream stream, std::uint64_t seed)
+{
+	GetEngine(stream).Seed(seed);
+}
+
+std::uint64_t GetRandomSeed()
+{
+	return GetStreams().seed;
+}
+
+std::uint64_t DeriveRandomSeed(std::uint64_t seed, std::uint64_t index)
+{
+	auto mixed = seed ^ (index * GOLDEN_GAMMA);
+	return MixSeed(mixed);
+}
+
+bool GetRandomBool(RandomStream stream)
+{
+	return (GetEngine(stream).Next() >> 63) != 0;
+}
+
+Direction GetRandomDirection(RandomStream stream)
+{
+	return static_cast<Direction>(GetEngine(stream).NextBelow(static_cast<std::uint32_t>(GetNumberOfDirections())));
+}
+
+int GetRandomNumberBetween(int min, int max, RandomStream stream)
+{
+	Assert(ERROR_RANDOM_RANGE_EMPTY, min <= max);
+	// Unsigned maths so even the full int range does not overflow
+	auto range = static_cast<std::uint32_t>(max) - static_cast<std::uint32_t>(min) + 1u;
+	auto offset = (range == 0) ? static_cast<std::uint32_t>(GetEngine(stream).Next() >> 32) : GetEngine(stream).NextBelow(range);
+	return static_cast<int>(static_cast<std::uint32_t>(min) + offset);
+}
+
+float GetRandomAngleOfMultiple(float multiple, RandomStream stream)
 {
 	Assert(ERROR_MULTIPLE_OUT_OF_RANGE, multiple > 0 && multiple <= MAX_ROTATION_DEGREES);
 	auto possibleAngles = static_cast<int>(MAX_ROTATION_DEGREES / multiple);
 
-	return GetRandomNumberBetween(0, possibleAngles - 1) * multiple;
+	return GetRandomNumberBetween(0, possibleAngles - 1, stream) * multiple;
+}
+
+ScopedRandomSeed::ScopedRandomSeed(RandomStream stream, std::uint64_t seed) :
+	m_Stream(stream),
+	m_SavedState(GetEngine(stream).GetState())
+{
+	GetEngine(stream).Seed(seed);
+}
+
+ScopedRandomSeed::~ScopedRandomSeed()
+{
+	GetEngine(m_Stream).SetState(m_SavedState);
 }
\ No newline at end of file
@@ -3,29 +3,127 @@
 #define RANDOM
 
 #include "Direction.h"
-#include <set>
+#include "ErrorLogging.h"	// for Assert()
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>		// for conditional_t
 
-bool GetRandomBool();
-Direction GetRandomDirection();
-int GetRandomNumberBetween(int min, int max);
+// Each subsystem draws from its own stream, so extra draws in one never shift the sequence of another
+enum class RandomStream { GENERAL, BOARD, AI, WEAPONS, COLLISIONS };
+
+static constexpr auto ERROR_BAG_VALUE_OUT_OF_RANGE = "Bag value is out of range - value must be between 0 and Capacity - 1.";
+static constexpr auto ERROR_BAG_EMPTY = "Bag is empty - use IsEmpty() to check before taking an element.";
+
+// Streams are per thread and start from a fixed default seed, so a thread only repeats a run if it is seeded the same way
+// Every stream gets its own seed derived from the given one
+void SeedRandomStreams(std::uint64_t seed);
+void SeedRandomStream(RandomStream stream, std::uint64_t seed);
+// Seed last given to SeedRandomStreams() on this thread, pass it on to threads that should replay with it
+std::uint64_t GetRandomSeed();
+// Mixes an index (e.g. worker or job) into a seed, nearby indeces still give unrelated streams
+std::uint64_t DeriveRandomSeed(std::uint64_t seed, std::uint64_t index);
+bool GetRandomBool(RandomStream stream = RandomStream::GENERAL);
+Direction GetRandomDirection(RandomStream stream = RandomStream::GENERAL);
+int GetRandomNumberBetween(int min, int max, RandomStream stream = RandomStream::GENERAL);
 // Returs angle in degrees between 0 and 360
-float GetRandomAngleOfMultiple(float multiple);
-// Returns a random element from the given set and also removes it from the set
-template<typename T>
-inline T TakeRandomElementFromSet(std::set<T>& set)
+float GetRandomAngleOfMultiple(float multiple, RandomStream stream = RandomStream::GENERAL);
+
+// Reseeds a stream of this thread for as long as it lives, then puts the stream back where it was
+// Lets a thread draw a sequence that only depends on the given seed without shifting its own sequence
+class ScopedRandomSeed
+{
+public:
+	ScopedRandomSeed(RandomStream stream, std::uint64_t seed);
+	~ScopedRandomSeed();
+
+	ScopedRandomSeed(ScopedRandomSeed&&) = delete;					// move ctor
+	ScopedRandomSeed(ScopedRandomSeed const&) = delete;				// copy ctor
+	void operator=(ScopedRandomSeed&&) = delete;					// move assignment
+	void operator=(ScopedRandomSeed const&) = delete;				// copy assignment
+
+private:
+	RandomStream m_Stream;
+	std::array<std::uint64_t, 4> m_SavedState;
+};
+
+// Set of the values 0 to Capacity - 1 that picks, inserts and removes in constant time without allocating
+// Values are packed at the front of one array and a second array maps each value to its place there
+template<int Capacity>
+class IndexableBag
 {
-	// Advance iterator to random position in set
-	auto iterator = set.begin();
-	advance(iterator, GetRandomNumberBetween(0, static_cast<int>(set.size()) - 1));
+public:
+	using Element = std::conditional_t<(Capacity <= std::numeric_limits<std::int16_t>::max()), std::int16_t, int>;
+
+	IndexableBag() :
+		m_Elements(),
+		m_Positions(),
+		m_Size()
+	{
+		m_Positions.fill(NOT_IN_BAG);
+	}
+
+	void Clear()
+	{
+		// Only the values in the bag have a position to forget
+		for (auto i = 0; i < m_Size; i++) { m_Positions[m_Elements[i]] = NOT_IN_BAG; }
+		m_Size = 0;
+	}
+
+	// Returns false if the value was already in the bag
+	bool Insert(int value)
+	{
+		if (Contains(value)) { return false; }
+		m_Positions[value] = static_cast<Element>(m_Size);
+		m_Elements[m_Size++] = static_cast<Element>(value);
+		return true;
+	}
+
+	// Returns false if the value was not in the bag
+	bool Remove(int value)
+	{
+		if (!Contains(value)) { return false; }
+		// Move the last value into the gap
+		auto position = m_Positions[value];
+		auto last = m_Elements[--m_Size];
+		m_Elements[position] = last;
+		m_Positions[last] = position;
+		m_Positions[value] = NOT_IN_BAG;
+		return true;
+	}
+
+	bool Contains(int value) const
+	{
+		Assert(ERROR_BAG_VALUE_OUT_OF_RANGE, value >= 0 && value < Capacity);
+		return m_Positions[value] != NOT_IN_BAG;
+	}
+
+	int GetRandom(RandomStream stream = RandomStream::GENERAL) const
+	{
+		Assert(ERROR_BAG_EMPTY, !IsEmpty());
+		return m_Elements[GetRandomNumberBetween(0, m_Size - 1, stream)];
+	}
+
+	// Returns a random value and also removes it from the bag
+	int TakeRandom(RandomStream stream = RandomStream::GENERAL)
+	{
+		auto value = GetRandom(stream);
+		Remove(value);
+		return value;
+	}
 
-	// Dereference iterator for element
-	auto element = *iterator;
+	int GetSize() const { return m_Size; }
+	bool IsEmpty() const { return m_Size == 0; }
+	// Values in no particular order, invalidated by the next insert or remove
+	std::span<const Element> GetElements() const { return std::span<const Element>(m_Elements.data(), m_Size); }
 
-	// Remove it from the set
-	set.erase(element);
+private:
+	static constexpr Element NOT_IN_BAG = -1;
 
-	// Return a copy of the element
-	return element;
-}
+	std::array<Element, Capacity> m_Elements;
+	std::array<Element, Capacity> m_Positions;
+	int m_Size;
+};
 
 #endif
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include "RenderQueue.h"
+#include <algorithm>	// for sort(), stable_sort() and find_if()
+#include <cmath>		// for abs()
+
+void RenderQueue::Add(const sf::Sprite& sprite, DrawOrder order)
+{
+	// sf::Sprite draws nothing without a texture either
+	auto* pTexture = sprite.getTexture();
+	if (pTexture == nullptr) { return; }
+
+	// Same corners and texture coordinates as sf::Sprite, a negative rectangle size flips the texture
+	auto rect = sprite.getTextureRect();
+	auto width = static_cast<float>(std::abs(rect.width));
+	auto height = static_cast<float>(std::abs(rect.height));
+	auto left = static_cast<float>(rect.left);
+	auto right = left + rect.width;
+	auto top = static_cast<float>(rect.top);
+	auto bottom = top + rect.height;
+	const auto& transform = sprite.getTransform();
+	auto color = sprite.getColor();
+
+	AddQuad({ sf::Vertex(transform.transformPoint(0.0f, 0.0f), color, sf::Vector2f(left, top)),
+		sf::Vertex(transform.transformPoint(width, 0.0f), color, sf::Vector2f(right, top)),
+		sf::Vertex(transform.transformPoint(width, height), color, sf::Vector2f(right, bottom)),
+		sf::Vertex(transform.transformPoint(0.0f, height), color, sf::Vector2f(left, bottom)) }, pTexture, order);
+}
+
+void RenderQueue::Add(sf::FloatRect rectangle, sf::Color color, DrawOrder order)
+{
+	auto right = rectangle.left + rectangle.width;
+	auto bottom = rectangle.top + rectangle.height;
+
+	AddQuad({ sf::Vertex(sf::Vector2f(rectangle.left, rectangle.top), color),
+		sf::Vertex(sf::Vector2f(right, rectangle.top), color),
+		sf::Vertex(sf::Vector2f(right, bottom), color),
+		sf::Vertex(sf::Vector2f(rectangle.left, bottom), color) }, nullptr, order);
+}
+
+// One sweep over the layers, back to front
+void RenderQueue::Draw(sf::RenderWindow& rWindow)
+{
+	m_DrawOrder.clear();
+	for (auto& rBatch : m_Batches) { if (rBatch.vertices.getVertexCount() > 0) { m_DrawOrder.push_back(&rBatch); } }
+	std::sort(m_DrawOrder.begin(), m_DrawOrder.end(), [](const Batch* pA, const Batch* pB)
+		{ return pA->layer != pB->layer ? pA->layer < pB->layer : pA->order < pB->order; });
+	// Stable so quads of equal depth (e.g. the player and their weapon) keep the order they were added in
+	std::stable_sort(m_SortedQuads.begin(), m_SortedQuads.end(), [](const SortedQuad& a, const SortedQuad& b)
+		{ return a.layer != b.layer ? a.layer < b.layer : a.depth < b.depth; });
+
+	auto batch = m_DrawOrder.cbegin();
+	auto quad = m_SortedQuads.cbegin();
+	while (batch != m_DrawOrder.cend() || quad != m_SortedQuads.cend())
+	{
+		// Next layer with anything in it, a layer is either batched or sorted so only one of the loops below draws
+		DrawLayer layer;
+		if (batch == m_DrawOrder.cend()) { layer = quad->layer; }
+		else if (quad == m_SortedQuads.cend()) { layer = (*batch)->layer; }
+		else { layer = std::min((*batch)->layer, quad->layer); }
+
+		for (; batch != m_DrawOrder.cend() && (*batch)->layer == layer; ++batch)
+		{
+			rWindow.draw((*batch)->vertices, (*batch)->pTexture);
+			// Keeps the capacity for the next frame
+			(*batch)->vertices.clear();
+		}
+		while (quad != m_SortedQuads.cend() && quad->layer == layer) { DrawSortedRun(rWindow, quad, layer); }
+	}
+	m_SortedQuads.clear();
+	m_NextOrder = 0;
+}
+
+void RenderQueue::AddQuad(const Quad& quad, const sf::Texture* pTexture, DrawOrder order)
+{
+	if (IsDepthSorted(order.layer))
+	{
+		m_SortedQuads.push_back({ order.layer, order.depth, pTexture, quad });
+		return;
+	}
+
+	auto& rVertices = GetVertices(pTexture, order.layer);
+	for (const auto& vertex : quad) { rVertices.append(vertex); }
+}
+
+// There are only ever a few dozen batches, a scan is cheaper than hashing
+sf::VertexArray& RenderQueue::GetVertices(const sf::Texture* pTexture, DrawLayer layer)
+{
+	auto found = std::find_if(m_Batches.begin(), m_Batches.end(),
+		[&](const Batch& batch) { return batch.pTexture == pTexture && batch.layer == layer; });
+	if (found == m_Batches.end())
+	{
+		m_Batches.push_back({ layer, pTexture, 0, sf::VertexArray(sf::Quads) });
+		found = m_Batches.end() - 1;
+	}
+
+	// First quad of the batch this frame ?
+	if (found->vertices.getVertexCount() == 0) { found->order = m_NextOrder++; }
+	return found->vertices;
+}
+
+// Draws the sorted quads from rQuad on for as long as they share its texture, most sprites are on the same atlas page
+// so a whole layer usually takes one draw call
+void RenderQueue::DrawSortedRun(sf::RenderWindow& rWindow, std::vector<SortedQuad>::const_iterator& rQuad, DrawLayer layer)
+{
+	auto* pTexture = rQuad->pTexture;
+	for (; rQuad != m_SortedQuads.cend() && rQuad->layer == layer && rQuad->pTexture == pTexture; ++rQuad)
+	{
+		for (const auto& vertex : rQuad->vertices) { m_SortedRun.append(vertex); }
+	}
+	rWindow.draw(m_SortedRun, pTexture);
+	m_SortedRun.clear();
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#pragma once
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <array>
+#include <vector>
+
+// Back to front, every layer is drawn before the next one
+enum class DrawLayer { ENEMIES_IN_GATES, GATES, STUCK_PROJECTILES, ACTORS, HEALTH_BARS, FLYING_PROJECTILES, COLLECTABLES };
+
+// Where a quad goes in the frame, the depth only matters on depth sorted layers
+struct DrawOrder
+{
+	DrawLayer layer;
+	float depth = 0.0f;
+
+	DrawOrder(DrawLayer _layer, float _depth = 0.0f) :
+		layer(_layer),
+		depth(_depth) {}
+};
+
+// Collects the quads of a frame and draws them with one draw call per texture per layer
+// Within a layer, textures are drawn in the order they were first added, and quads of the same texture in the order
+// they were added, so objects drawn one after another keep their order as long as their textures dont interleave
+// Depth sorted layers are drawn from lowest to highest depth instead, quads of equal depth in the order they were added
+class RenderQueue
+{
+public:
+	void Add(const sf::Sprite& sprite, DrawOrder order);
+	// Untextured, all rectangles of a layer share one draw call
+	void Add(sf::FloatRect rectangle, sf::Color color, DrawOrder order);
+	// Draws everything added since the last call and empties the queue
+	void Draw(sf::RenderWindow& rWindow);
+
+private:
+	static constexpr auto VERTICES_PER_QUAD = 4;
+	using Quad = std::array<sf::Vertex, VERTICES_PER_QUAD>;
+
+	struct Batch
+	{
+		DrawLayer layer;
+		const sf::Texture* pTexture;
+		// When the batch was first added to this frame
+		int order;
+		sf::VertexArray vertices;
+	};
+
+	struct SortedQuad
+	{
+		DrawLayer layer;
+		float depth;
+		const sf::Texture* pTexture;
+		Quad vertices;
+	};
+
+	// Batches are kept between frames so their vertex memory is reused
+	std::vector<Batch> m_Batches;
+	std::vector<Batch*> m_DrawOrder;
+	int m_NextOrder = 0;
+	std::vector<SortedQuad> m_SortedQuads;
+	// Consecutive sorted quads sharing a texture, drawn together
+	sf::VertexArray m_SortedRun = sf::VertexArray(sf::Quads);
+
+	// Actors are sorted by their feet, so whoever stands lower on screen is drawn in front
+	static constexpr bool IsDepthSorted(DrawLayer layer) { return layer == DrawLayer::ACTORS; }
+	void AddQuad(const Quad& quad, const sf::Texture* pTexture, DrawOrder order);
+	sf::VertexArray& GetVertices(const sf::Texture* pTexture, DrawLayer layer);
+	void DrawSortedRun(sf::RenderWindow& rWindow, std::vector<SortedQuad>::const_iterator& rQuad, DrawLayer layer);
+};
+
+#endif
\ No newline at end of file
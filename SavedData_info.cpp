@@ -3,6 +3,7 @@
 static constexpr auto SAVEDATA_DIRECTORY = "Savedata/";
 static constexpr auto GAMESAVE_FILENAME = "Gamesave.txt";
 static constexpr auto HIGHSCORES_FILENAME = "Highscores.txt";
+static constexpr auto PUZZLE_BANK_FILENAME = "Puzzles.bank";
 
 std::string GetGameSavePath()
 {
@@ -12,4 +13,9 @@ std::string GetGameSavePath()
 std::string GetHighscoresPath()
 {
 	return std::string(SAVEDATA_DIRECTORY).append(HIGHSCORES_FILENAME);
+}
+
+std::string GetPuzzleBankPath()
+{
+	return std::string(SAVEDATA_DIRECTORY).append(PUZZLE_BANK_FILENAME);
 }
\ No newline at end of file
@@ -6,5 +6,6 @@
 
 std::string GetGameSavePath();
 std::string GetHighscoresPath();
+std::string GetPuzzleBankPath();
 
 #endif
\ No newline at end of file
@@ -0,0 +1,41 @@
+#include "SeedSolutions_info.h"
+#include "Random.h"				// for GetRandomNumberBetween()
+#include "ErrorLogging.h"		// for Assert()
+
+static constexpr auto ERROR_SEED_SOLUTION_OUT_OF_RANGE = "Seed solution index is out of range - value must be between 0 and GetNumberOfSeedSolutions() - 1.";
+
+static constexpr SudokuGrid ParseSolution(const char* pDigits)
+{
+	SudokuGrid grid{};
+	for (auto cell = 0; cell < BOARD_CELLS; cell++) { grid[cell] = static_cast<std::uint8_t>(pDigits[cell] - '0'); }
+	return grid;
+}
+
+// Each grid has about 1.2 trillion symmetric variants, a handful is plenty
+static constexpr std::array<SudokuGrid, 8> SEED_SOLUTIONS =
+{
+	ParseSolution("987653412235714869461298375829361754713549286546827931158432697674985123392176548"),
+	ParseSolution("637258491814693572295741863368429715942175386571836249183567924729314658456982137"),
+	ParseSolution("716983542328514679945276138589721463274639815631458927852147396493862751167395284"),
+	ParseSolution("137542896625981734498637251384795612961324587572168943816479325759213468243856179"),
+	ParseSolution("823514796714369852569278134257946318348721965691835247472153689185692473936487521"),
+	ParseSolution("418536297726941853395872641569283714842157936137694528284719365971365482653428179"),
+	ParseSolution("249173685153968247678542193562897431731254869984631752415789326826315974397426518"),
+	ParseSolution("543182679196357284827496531451879362769243158238561497984615723672934815315728946")
+};
+
+int GetNumberOfSeedSolutions()
+{
+	return static_cast<int>(SEED_SOLUTIONS.size());
+}
+
+const SudokuGrid& GetSeedSolution(int index)
+{
+	Assert(ERROR_SEED_SOLUTION_OUT_OF_RANGE, index >= 0 && index < GetNumberOfSeedSolutions());
+	return SEED_SOLUTIONS[index];
+}
+
+const SudokuGrid& GetRandomSeedSolution()
+{
+	return GetSeedSolution(GetRandomNumberBetween(0, GetNumberOfSeedSolutions() - 1, RandomStream::BOARD));
+}
\ No newline at end of file
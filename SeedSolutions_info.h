@@ -0,0 +1,12 @@
+#pragma once
+#ifndef SEED_SOLUTIONS_INFO
+#define SEED_SOLUTIONS_INFO
+
+#include "Board_info.h"		// for SudokuGrid
+
+// Small bank of solved grids that new sudokus are transformed from, see Board::GenerateNewSudoku(seedSolution)
+int GetNumberOfSeedSolutions();
+const SudokuGrid& GetSeedSolution(int index);
+const SudokuGrid& GetRandomSeedSolution();
+
+#endif
\ No newline at end of file
@@ -0,0 +1,431 @@
+#include "SimdSolver.h"
+#include "ErrorLogging.h"	// for Assert()
+#include <bit>				// for countr_zero()
+#if defined(_M_X64) || defined(__x86_64__)
+	#include <emmintrin.h>	// for SSE2 intrinsics
+	#define SIMD_SOLVER_SSE2
+	#define SIMD_SOLVER_64_BIT_MOVES
+#elif (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+	// 32-bit x86 built with /arch:SSE2 (MSVC's default), which is how the game ships
+	#include <emmintrin.h>	// for SSE2 intrinsics
+	#define SIMD_SOLVER_SSE2
+#endif
+#if defined(__AVX__) || defined(__SSE4_1__)
+	#include <smmintrin.h>	// for _mm_testz_si128()
+	#define SIMD_SOLVER_SSE41
+#endif
+
+// Cells are stored band by band, one 32-bit lane per band of BOX_SIZE rows, so a band is BAND_BITS bits of rows back to back
+static constexpr auto BAND_COUNT = BOX_SIZE;
+static constexpr auto BAND_BITS = BOX_SIZE * BOARD_SIZE;
+static constexpr auto LANE_BITS = 32;
+static constexpr auto WORD_BITS = 64;
+static constexpr auto BAND_MASK = (1u << BAND_BITS) - 1;
+static constexpr auto LINE_MASK = (1u << BOARD_SIZE) - 1;
+// The first box of a band, the others are shifted by BOX_SIZE
+static constexpr auto BAND_BOX_MASK = 0x7u | (0x7u << BOARD_SIZE) | (0x7u << (2 * BOARD_SIZE));
+static constexpr auto ERROR_GRID_VALUE_OUT_OF_RANGE = "Grid value is out of range - value must be between 0 and 9.";
+
+static constexpr int CalcCellBit(int cell)
+{
+	auto row = cell / BOARD_SIZE;
+	return (row / BOX_SIZE) * LANE_BITS + (row % BOX_SIZE) * BOARD_SIZE + cell % BOARD_SIZE;
+}
+
+static constexpr int CalcBitCell(int bit)
+{
+	auto inBand = bit % LANE_BITS;
+	return ((bit / LANE_BITS) * BOX_SIZE + inBand / BOARD_SIZE) * BOARD_SIZE + inBand % BOARD_SIZE;
+}
+
+// Set of cells in band layout
+class CellSet
+{
+public:
+	CellSet() = default;
+
+#ifdef SIMD_SOLVER_SSE2
+#ifdef SIMD_SOLVER_64_BIT_MOVES
+	CellSet(std::uint64_t low, std::uint64_t high) : m_Bits(_mm_set_epi64x(static_cast<long long>(high), static_cast<long long>(low))) {}
+#else
+	CellSet(std::uint64_t low, std::uint64_t high) : m_Bits(_mm_set_epi32(static_cast<int>(high >> LANE_BITS), static_cast<int>(high),
+		static_cast<int>(low >> LANE_BITS), static_cast<int>(low))) {}
+#endif
+	friend CellSet operator&(CellSet a, CellSet b) { return CellSet(_mm_and_si128(a.m_Bits, b.m_Bits)); }
+	friend CellSet operator|(CellSet a, CellSet b) { return CellSet(_mm_or_si128(a.m_Bits, b.m_Bits)); }
+	// Cells of a that are not in b
+	friend CellSet AndNot(CellSet a, CellSet b) { return CellSet(_mm_andnot_si128(b.m_Bits, a.m_Bits)); }
+	std::uint64_t GetLow() const { return GetLowWord(m_Bits); }
+	std::uint64_t GetHigh() const { return GetLowWord(_mm_unpackhi_epi64(m_Bits, m_Bits)); }
+#ifdef SIMD_SOLVER_SSE41
+	bool IsEmpty() const { return _mm_testz_si128(m_Bits, m_Bits) != 0; }
+#else
+	bool IsEmpty() const { return _mm_movemask_epi8(_mm_cmpeq_epi8(m_Bits, _mm_setzero_si128())) == 0xFFFF; }
+#endif
+#else
+	CellSet(std::uint64_t low, std::uint64_t high) : m_Low(low), m_High(high) {}
+	friend CellSet operator&(CellSet a, CellSet b) { return CellSet(a.m_Low & b.m_Low, a.m_High & b.m_High); }
+	friend CellSet operator|(CellSet a, CellSet b) { return CellSet(a.m_Low | b.m_Low, a.m_High | b.m_High); }
+	friend CellSet AndNot(CellSet a, CellSet b) { return CellSet(a.m_Low & ~b.m_Low, a.m_High & ~b.m_High); }
+	std::uint64_t GetLow() const { return m_Low; }
+	std::uint64_t GetHigh() const { return m_High; }
+	bool IsEmpty() const { return (m_Low | m_High) == 0; }
+#endif
+
+	CellSet& operator|=(CellSet other) { return *this = *this | other; }
+
+	static CellSet FromBands(const std::array<std::uint32_t, BAND_COUNT>& bands)
+	{
+		return CellSet(bands[0] | (static_cast<std::uint64_t>(bands[1]) << LANE_BITS), bands[2]);
+	}
+
+	std::array<std::uint32_t, BAND_COUNT> GetBands() const
+	{
+		auto low = GetLow();
+		return { static_cast<std::uint32_t>(low), static_cast<std::uint32_t>(low >> LANE_BITS), static_cast<std::uint32_t>(GetHigh()) };
+	}
+
+	bool Contains(int cell) const
+	{
+		auto bit = CalcCellBit(cell);
+		return (bit < WORD_BITS) ? ((GetLow() >> bit) & 1) != 0 : ((GetHigh() >> (bit - WORD_BITS)) & 1) != 0;
+	}
+
+	// Calls function(cell) for every cell in the set, stops early if it returns false
+	template<typename Function>
+	bool ForEachCell(Function function) const
+	{
+		for (auto low = GetLow(); low != 0; low &= low - 1)
+			if (!function(CalcBitCell(std::countr_zero(low)))) { return false; }
+		for (auto high = GetHigh(); high != 0; high &= high - 1)
+			if (!function(CalcBitCell(WORD_BITS + std::countr_zero(high)))) { return false; }
+		return true;
+	}
+
+private:
+#ifdef SIMD_SOLVER_SSE2
+	explicit CellSet(__m128i bits) : m_Bits(bits) {}
+	__m128i m_Bits;
+
+#ifdef SIMD_SOLVER_64_BIT_MOVES
+	static std::uint64_t GetLowWord(__m128i bits) { return static_cast<std::uint64_t>(_mm_cvtsi128_si64(bits)); }
+#else
+	// 32-bit targets cannot move 64 bits from an SSE register to general registers, so the word goes through memory
+	static std::uint64_t GetLowWord(__m128i bits)
+	{
+		std::uint64_t word;
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(&word), bits);
+		return word;
+	}
+#endif
+#else
+	std::uint64_t m_Low;
+	std::uint64_t m_High;
+#endif
+};
+
+// Single cell and peer sets as plain words, so they can be built at compile time
+struct CellWords
+{
+	std::uint64_t low;
+	std::uint64_t high;
+};
+
+struct WordTopology
+{
+	std::array<CellWords, BOARD_CELLS> cells;
+	std::array<CellWords, BOARD_CELLS> peers;
+	CellWords allCells;
+};
+
+static constexpr void AddCell(CellWords& rWords, int cell)
+{
+	auto bit = CalcCellBit(cell);
+	if (bit < WORD_BITS) { rWords.low |= 1ull << bit; }
+	else { rWords.high |= 1ull << (bit - WORD_BITS); }
+}
+
+static constexpr WordTopology MakeWordTopology()
+{
+	WordTopology topology{};
+
+	for (auto cell = 0; cell < BOARD_CELLS; cell++)
+	{
+		AddCell(topology.cells[cell], cell);
+		AddCell(topology.allCells, cell);
+
+		for (auto other = 0; other < BOARD_CELLS; other++)
+		{
+			auto sameRow = other / BOARD_SIZE == cell / BOARD_SIZE;
+			auto sameColumn = other % BOARD_SIZE == cell % BOARD_SIZE;
+			auto sameBox = (other / BOARD_SIZE / BOX_SIZE == cell / BOARD_SIZE / BOX_SIZE) && (other % BOARD_SIZE / BOX_SIZE == cell % BOARD_SIZE / BOX_SIZE);
+			if (other != cell && (sameRow || sameColumn || sameBox)) { AddCell(topology.peers[cell], other); }
+		}
+	}
+
+	return topology;
+}
+
+static constexpr auto WORD_TOPOLOGY = MakeWordTopology();
+
+static CellSet GetCell(int cell)
+{
+	return CellSet(WORD_TOPOLOGY.cells[cell].low, WORD_TOPOLOGY.cells[cell].high);
+}
+
+static CellSet GetPeers(int cell)
+{
+	return CellSet(WORD_TOPOLOGY.peers[cell].low, WORD_TOPOLOGY.peers[cell].high);
+}
+
+static bool HasSingleBit(std::uint32_t bits)
+{
+	return bits != 0 && (bits & (bits - 1)) == 0;
+}
+
+// Finds the cells that are the only place left for a value in their row, column or box
+// Returns false if the value has no place left in some unit
+static bool FindHiddenSingles(CellSet places, CellSet& rSingles)
+{
+	auto bands = places.GetBands();
+	std::array<std::uint32_t, BAND_COUNT> singles = {};
+	std::array<std::uint32_t, BAND_COUNT> columnsAny;
+	auto columnsOnce = 0u;
+	auto columnsTwice = 0u;
+
+	for (auto band = 0; band < BAND_COUNT; band++)
+	{
+		auto bits = bands[band];
+
+		// Rows and boxes are 9 bit groups inside the band
+		for (auto i = 0; i < BOX_SIZE; i++)
+		{
+			auto row = bits & (LINE_MASK << (i * BOARD_SIZE));
+			auto box = bits & (BAND_BOX_MASK << (i * BOX_SIZE));
+			if (row == 0 || box == 0) { return false; }
+			if (HasSingleBit(row)) { singles[band] |= row; }
+			if (HasSingleBit(box)) { singles[band] |= box; }
+		}
+
+		// Fold the band's rows onto each other to count the column's places in this band, then across bands
+		auto first = bits & LINE_MASK;
+		auto second = (bits >> BOARD_SIZE) & LINE_MASK;
+		auto third = (bits >> (2 * BOARD_SIZE)) & LINE_MASK;
+		columnsAny[band] = first | second | third;
+		columnsTwice |= (first & second) | (first & third) | (second & third) | (columnsOnce & columnsAny[band]);
+		columnsOnce |= columnsAny[band];
+	}
+
+	if (columnsOnce != LINE_MASK) { return false; }
+
+	// Spread each column with a single place back over the rows of the band holding it
+	auto columnSingles = columnsOnce & ~columnsTwice;
+	for (auto band = 0; band < BAND_COUNT; band++)
+	{
+		auto columns = columnSingles & columnsAny[band];
+		singles[band] |= bands[band] & (columns | (columns << BOARD_SIZE) | (columns << (2 * BOARD_SIZE)));
+	}
+
+	rSingles = CellSet::FromBands(singles);
+	return true;
+}
+
+struct SimdSolver::State
+{
+	// Cells where each value is still possible, a solved cell keeps only the bit of its value
+	std::array<CellSet, BOARD_SIZE> candidates;
+	CellSet unsolved;
+};
+
+SimdSolver::SimdSolver() :
+	m_SolutionCount(),
+	m_SolutionLimit(),
+	mp_FirstSolution(nullptr)
+{
+}
+
+// Which of the CellSet implementations this build uses, so benchmark results can say what they measured
+const char* SimdSolver::GetInstructionSet()
+{
+#if defined(SIMD_SOLVER_SSE41)
+	return "SSE4.1";
+#elif defined(SIMD_SOLVER_SSE2) && defined(SIMD_SOLVER_64_BIT_MOVES)
+	return "SSE2 x64";
+#elif defined(SIMD_SOLVER_SSE2)
+	return "SSE2 x86";
+#else
+	return "scalar";
+#endif
+}
+
+bool SimdSolver::Solve(const SudokuGrid& puzzle, SudokuGrid& rSolution)
+{
+	return Run(puzzle, 1, &rSolution) > 0;
+}
+
+int SimdSolver::CountSolutions(const SudokuGrid& puzzle, int limit)
+{
+	return Run(puzzle, limit, nullptr);
+}
+
+int SimdSolver::Run(const SudokuGrid& puzzle, int limit, SudokuGrid* pFirstSolution)
+{
+	m_SolutionCount = 0;
+	m_SolutionLimit = limit;
+	mp_FirstSolution = pFirstSolution;
+	if (limit <= 0) { return 0; }
+
+	auto allCells = CellSet(WORD_TOPOLOGY.allCells.low, WORD_TOPOLOGY.allCells.high);
+	State state;
+	state.candidates.fill(allCells);
+	state.unsolved = allCells;
+
+	// Place the givens, a given clashing with an earlier one means no solution
+	for (auto cell = 0; cell < BOARD_CELLS; cell++)
+	{
+		auto value = static_cast<int>(puzzle[cell]);
+		if (value == EMPTY_CELL_VALUE) { continue; }
+		if (value > BOARD_SIZE)
+		{
+			Assert(ERROR_GRID_VALUE_OUT_OF_RANGE);
+			return 0;
+		}
+		if (!state.candidates[value - 1].Contains(cell)) { return 0; }
+		Place(state, value - 1, cell);
+	}
+
+	Search(state);
+	mp_FirstSolution = nullptr;
+	return m_SolutionCount;
+}
+
+void SimdSolver::Search(State& rState)
+{
+	if (!Propagate(rState)) { return; }
+
+	// All cells solved ?
+	if (rState.unsolved.IsEmpty())
+	{
+		RecordSolution(rState);
+		return;
+	}
+
+	// Branch on a cell with two candidates if there is one, found for all cells at once like in Propagate()
+	CellSet once(0, 0);
+	CellSet twice(0, 0);
+	CellSet thrice(0, 0);
+	for (const auto& candidates : rState.candidates)
+	{
+		thrice |= twice & candidates;
+		twice |= once & candidates;
+		once |= candidates;
+	}
+	auto pairs = AndNot(rState.unsolved & twice, thrice);
+	auto branchCell = -1;
+	if (!pairs.IsEmpty())
+	{
+		pairs.ForEachCell([&](int cell) { branchCell = cell; return false; });
+	}
+	// Otherwise the unsolved cell with the fewest candidates
+	else
+	{
+		auto fewest = BOARD_SIZE + 1;
+		rState.unsolved.ForEachCell([&](int cell)
+		{
+			auto count = 0;
+			for (const auto& candidates : rState.candidates) { count += candidates.Contains(cell) ? 1 : 0; }
+			if (count < fewest)
+			{
+				fewest = count;
+				branchCell = cell;
+			}
+			return true;
+		});
+	}
+
+	for (auto value = 0; value < BOARD_SIZE && m_SolutionCount < m_SolutionLimit; value++)
+	{
+		if (!rState.candidates[value].Contains(branchCell)) { continue; }
+		auto branch = rState;
+		Place(branch, value, branchCell);
+		Search(branch);
+	}
+}
+
+void SimdSolver::RecordSolution(const State& state)
+{
+	m_SolutionCount++;
+	if (mp_FirstSolution == nullptr || m_SolutionCount > 1) { return; }
+
+	for (auto value = 0; value < BOARD_SIZE; value++)
+	{
+		state.candidates[value].ForEachCell([&](int cell)
+		{
+			(*mp_FirstSolution)[cell] = static_cast<std::uint8_t>(value + 1);
+			return true;
+		});
+	}
+}
+
+bool SimdSolver::Propagate(State& rState)
+{
+	for (;;)
+	{
+		// Count candidates of all cells at once: once holds cells with at least one, twice those with at least two
+		CellSet once(0, 0);
+		CellSet twice(0, 0);
+		for (const auto& candidates : rState.candidates)
+		{
+			twice |= once & candidates;
+			once |= candidates;
+		}
+
+		// An unsolved cell without candidates ?
+		if (!AndNot(rState.unsolved, once).IsEmpty()) { return false; }
+
+		// Naked singles, checked again before placing since an earlier one this pass may have taken the value
+		auto nakedSingles = AndNot(rState.unsolved & once, twice);
+		if (!nakedSingles.IsEmpty())
+		{
+			for (auto value = 0; value < BOARD_SIZE; value++)
+			{
+				auto consistent = (nakedSingles & rState.candidates[value]).ForEachCell([&](int cell)
+				{
+					if (!rState.candidates[value].Contains(cell)) { return false; }
+					Place(rState, value, cell);
+					return true;
+				});
+				if (!consistent) { return false; }
+			}
+			continue;
+		}
+
+		// Hidden singles, a solved cell is the only place of its value in all its units so only unsolved ones count
+		auto progress = false;
+		for (auto value = 0; value < BOARD_SIZE; value++)
+		{
+			CellSet hiddenSingles;
+			if (!FindHiddenSingles(rState.candidates[value], hiddenSingles)) { return false; }
+
+			auto consistent = (hiddenSingles & rState.unsolved).ForEachCell([&](int cell)
+			{
+				// Placing a value elsewhere this pass may have taken the place, or even the whole cell
+				if (!rState.candidates[value].Contains(cell) || !rState.unsolved.Contains(cell)) { return false; }
+				Place(rState, value, cell);
+				progress = true;
+				return true;
+			});
+			if (!consistent) { return false; }
+		}
+
+		if (!progress) { return true; }
+	}
+}
+
+void SimdSolver::Place(State& rState, int value, int cell)
+{
+	auto cellSet = GetCell(cell);
+	for (auto& candidates : rState.candidates) { candidates = AndNot(candidates, cellSet); }
+	rState.candidates[value] = AndNot(rState.candidates[value], GetPeers(cell)) | cellSet;
+	rState.unsolved = AndNot(rState.unsolved, cellSet);
+}
\ No newline at end of file
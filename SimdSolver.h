@@ -0,0 +1,36 @@
+#pragma once
+#ifndef SIMD_SOLVER_H
+#define SIMD_SOLVER_H
+
+#include "SudokuSolver.h"	// also includes "Board.h" and "Board_info.h"
+
+// Solves 9x9 sudokus on bitboards, one 81 bit set of cells per value, held in SSE registers on x86-64 and on x86 with SSE2
+// Naked and hidden singles are found for all cells at once between branching steps
+// Other targets use two 64-bit words per set instead
+class SimdSolver final : public SudokuSolver
+{
+public:
+	SimdSolver();
+	using SudokuSolver::Solve;
+	using SudokuSolver::CountSolutions;
+	bool Solve(const SudokuGrid& puzzle, SudokuGrid& rSolution) override;
+	int CountSolutions(const SudokuGrid& puzzle, int limit = UNLIMITED_SOLUTIONS) override;
+	static const char* GetInstructionSet();
+
+private:
+	struct State;
+
+	int m_SolutionCount;
+	int m_SolutionLimit;
+	SudokuGrid* mp_FirstSolution;
+
+	int Run(const SudokuGrid& puzzle, int limit, SudokuGrid* pFirstSolution);
+	// Works on rState in place, every branch gets its own copy
+	void Search(State& rState);
+	void RecordSolution(const State& state);
+	// Applies naked and hidden singles until neither finds anything, returns false on a contradiction
+	static bool Propagate(State& rState);
+	static void Place(State& rState, int value, int cell);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+#ifndef SUDOKU_SOLVER_H
+#define SUDOKU_SOLVER_H
+
+#include "Board.h"			// also includes "Board_info.h"
+#include <limits>
+
+static constexpr auto UNLIMITED_SOLUTIONS = std::numeric_limits<int>::max();
+
+// Common interface of the solver backends, so callers and benchmarks can swap one for another
+template<int BoxSize>
+class BasicSudokuSolver
+{
+public:
+	using Grid = typename BoardTraits<BoxSize>::Grid;
+
+	virtual ~BasicSudokuSolver() = default;
+	// Returns false if the puzzle has no solution, otherwise rSolution holds the first one found
+	virtual bool Solve(const Grid& puzzle, Grid& rSolution) = 0;
+	// Stops as soon as limit solutions are found, use a limit of 2 for uniqueness checks
+	virtual int CountSolutions(const Grid& puzzle, int limit = UNLIMITED_SOLUTIONS) = 0;
+
+	bool Solve(const BasicBoard<BoxSize>& board, Grid& rSolution)
+	{
+		return Solve(board.GetGivenGrid(), rSolution);
+	}
+
+	int CountSolutions(const BasicBoard<BoxSize>& board, int limit = UNLIMITED_SOLUTIONS)
+	{
+		return CountSolutions(board.GetGivenGrid(), limit);
+	}
+};
+
+using SudokuSolver = BasicSudokuSolver<BOX_SIZE>;
+
+#endif
\ No newline at end of file
@@ -0,0 +1,45 @@
+#include "Technique.h"
+#include "ErrorLogging.h"	// for Assert()
+
+bool IsTechniqueHarder(Technique technique, Technique than)
+{
+	return static_cast<int>(technique) > static_cast<int>(than);
+}
+
+std::string GetTechniqueString(Technique technique)
+{
+	switch (technique)
+	{
+	case Technique::NONE:
+		return "NONE";
+		break;
+	case Technique::NAKED_SINGLE:
+		return "NAKED SINGLE";
+		break;
+	case Technique::HIDDEN_SINGLE:
+		return "HIDDEN SINGLE";
+		break;
+	case Technique::LOCKED_CANDIDATES:
+		return "LOCKED CANDIDATES";
+		break;
+	case Technique::NAKED_PAIR:
+		return "NAKED PAIR";
+		break;
+	case Technique::HIDDEN_PAIR:
+		return "HIDDEN PAIR";
+		break;
+	case Technique::NAKED_TRIPLE:
+		return "NAKED TRIPLE";
+		break;
+	case Technique::HIDDEN_TRIPLE:
+		return "HIDDEN TRIPLE";
+		break;
+	case Technique::X_WING:
+		return "X-WING";
+		break;
+	default:
+		Assert(ERROR_UNKNOWN_TECHNIQUE);
+		return "";
+		break;
+	}
+}
\ No newline at end of file
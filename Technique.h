@@ -0,0 +1,14 @@
+#pragma once
+#ifndef TECHNIQUE
+#define TECHNIQUE
+
+#include <string>
+
+// Human solving techniques, in increasing order of cost
+enum class Technique { NONE, NAKED_SINGLE, HIDDEN_SINGLE, LOCKED_CANDIDATES, NAKED_PAIR, HIDDEN_PAIR, NAKED_TRIPLE, HIDDEN_TRIPLE, X_WING };
+static constexpr auto ERROR_UNKNOWN_TECHNIQUE = "Unknown technique - add case for all techniques";
+
+bool IsTechniqueHarder(Technique technique, Technique than);
+std::string GetTechniqueString(Technique technique);
+
+#endif
\ No newline at end of file
@@ -1,10 +1,53 @@
 #include "TextPrinting.h"
 #include "ErrorLogging.h"			// for Assert()
 #include "StringManipulation.h"		// for ContainsNewLine()
+#include <functional>				// for hash
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+// Everything that changes how the lines of a text are laid out, position is applied at draw time
+struct TextLayoutKey
+{
+	std::string text;
+	const sf::Font* pFont;
+	int size;
+	TextStyle style;
+	sf::Color color;
+	sf::Color outlineColor;
+	float outlineThickness;
+
+	bool operator==(const TextLayoutKey& other) const = default;
+};
+
+struct TextLayoutKeyHash
+{
+	size_t operator()(const TextLayoutKey& key) const
+	{
+		auto hash = std::hash<std::string>()(key.text);
+		for (auto value : { std::hash<const void*>()(key.pFont), static_cast<size_t>(key.size), static_cast<size_t>(key.style),
+			static_cast<size_t>(key.color.toInteger()), static_cast<size_t>(key.outlineColor.toInteger()), std::hash<float>()(key.outlineThickness) })
+		{
+			hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+		}
+		return hash;
+	}
+};
+
+struct TextLayout
+{
+	TextLayoutKey key;
+	// One text per line, each with its origin centered, sf::Text keeps its glyph geometry until its string or style changes
+	std::vector<sf::Text> lines;
+};
 
 static sf::Font defaultFont;
 static sf::Font symmetricFont;
 static bool fontsLoaded = false;
+// Most recently used first
+static std::list<TextLayout> textLayouts;
+static std::unordered_map<TextLayoutKey, std::list<TextLayout>::iterator, TextLayoutKeyHash> textLayoutIndex;
+static TextLayoutCacheStats textLayoutCacheStats = {};
 
 static constexpr auto FONTS_DIRECTORY = "Fonts/";
 static constexpr auto FONT_FILE_EXTENSION = ".ttf";
@@ -16,6 +59,8 @@ static constexpr auto MAX_ALIGNMENT = 1.0f;
 static constexpr auto MAX_TEXT_SIZE = 100;
 static constexpr auto MAX_OUTLINE_SIZE = 100.0f;
 static constexpr auto MAX_LINE_SPACING = 100.0f;
+// Enough for every text on the busiest screen, text that changes every frame or second is evicted quickly
+static constexpr auto TEXT_LAYOUT_CACHE_CAPACITY = 128;
 static constexpr auto ERROR_X_ALIGNMENT = "X ";
 static constexpr auto ERROR_Y_ALIGNMENT = "Y ";
 static constexpr auto ERROR_ALIGNMENT_OUT_OF_RANGE = "Alignment out of range - value must be between 0.0f and 1.0f.";
@@ -31,14 +76,81 @@ static void LoadFonts()
 	fontsLoaded = true;
 }
 
+// Splits the text on newlines and centers each line, only done the first time a text is printed
+static void LayOutText(TextLayout& rLayout)
+{
+	const auto& key = rLayout.key;
+	sf::Text _text;
+	_text.setFont(*key.pFont);
+	_text.setCharacterSize(static_cast<unsigned int>(key.size));
+	_text.setStyle(static_cast<sf::Uint32>(key.style));
+	_text.setOutlineColor(key.outlineColor);
+	_text.setOutlineThickness(key.outlineThickness);
+	_text.setFillColor(key.color);
+
+	// Check string for any NEWLINE characters
+	std::pair<bool, size_t> foundNL;
+	sf::FloatRect textBox;
+	auto textRemaining = key.text;
+
+	do
+	{
+		// Extract text before newline
+		foundNL = ContainsNewLine(textRemaining);
+		_text.setString(textRemaining.substr(0, foundNL.second));
+		if (foundNL.first) { textRemaining = textRemaining.substr(foundNL.second + 1); } //+1 to skip newline character
+
+		// Center each line separately
+		textBox = _text.getLocalBounds();
+		_text.setOrigin(sf::Vector2f(textBox.left + roundf(0.5f * (textBox.width)), textBox.top + roundf(0.5f * (textBox.height))));  // round to fix outline distortments
+		rLayout.lines.push_back(_text);
+	}
+	while (foundNL.first);
+}
+
+static std::vector<sf::Text>& GetTextLines(TextLayoutKey&& rKey)
+{
+	// Seen before ? Move it to the front
+	auto found = textLayoutIndex.find(rKey);
+	if (found != textLayoutIndex.end())
+	{
+		textLayoutCacheStats.hits++;
+		textLayouts.splice(textLayouts.begin(), textLayouts, found->second);
+		return found->second->lines;
+	}
+
+	// Make room by evicting the least recently used
+	textLayoutCacheStats.misses++;
+	if (textLayouts.size() >= TEXT_LAYOUT_CACHE_CAPACITY)
+	{
+		textLayoutIndex.erase(textLayouts.back().key);
+		textLayouts.pop_back();
+	}
+
+	textLayouts.push_front({ std::move(rKey), {} });
+	LayOutText(textLayouts.front());
+	textLayoutIndex.emplace(textLayouts.front().key, textLayouts.begin());
+	return textLayouts.front().lines;
+}
+
 std::string GetFontPath(std::string filename)
 {
 	return std::string(FONTS_DIRECTORY).append(filename).append(FONT_FILE_EXTENSION);
 }
 
+sf::Font& GetFont(FontStyle font)
+{
+	if (!fontsLoaded) { LoadFonts(); }
+	return (font == DEFAULT_FONT_STYLE) ? defaultFont : symmetricFont;
+}
+
+TextLayoutCacheStats GetTextLayoutCacheStats()
+{
+	return textLayoutCacheStats;
+}
+
 void PrintText(sf::RenderWindow& rWindow, sf::Vector2f alignment, std::string text, int size, sf::Color color, sf::Color outlineColor, float outlineThickness, sf::Font& customFont, TextStyle style, float lineSpacing)
 {
-	sf::Text _text;
 	if (!fontsLoaded) { LoadFonts(); }
 
 	Assert(std::string(ERROR_X_ALIGNMENT) + ERROR_ALIGNMENT_OUT_OF_RANGE, alignment.x >= 0.0f && alignment.x <= MAX_ALIGNMENT);
@@ -48,38 +160,15 @@ void PrintText(sf::RenderWindow& rWindow, sf::Vector2f alignment, std::string te
 	Assert(ERROR_OUTLINE_THICKNESS_OUT_OF_RANGE, outlineThickness >= 0.0f && outlineThickness <= MAX_OUTLINE_SIZE);
 	Assert(ERROR_LINE_SPACING_OUT_OF_RANGE, lineSpacing >= 0.0f && lineSpacing <= MAX_LINE_SPACING);
 
-	// Apply given values
-	_text.setFont(customFont);
-	_text.setCharacterSize(static_cast<unsigned int>(size));
-	_text.setStyle(static_cast<sf::Uint32>(style));
-	_text.setOutlineColor(outlineColor);
-	_text.setOutlineThickness(outlineThickness);
-	_text.setFillColor(color);
-
-	// Check string for any NEWLINE characters
-	std::pair<bool, size_t> foundNL;
-	std::string curLineText;
-	sf::FloatRect textBox;
-	float curLineVerticalAlignment;
-	auto textRemaining = text;
-	auto lineCount = 0;
-
-	do
+	// Position and print each line separately
+	auto& rLines = GetTextLines({ std::move(text), &customFont, size, style, color, outlineColor, outlineThickness });
+	auto windowSize = sf::Vector2f(rWindow.getSize());
+	for (size_t line = 0; line < rLines.size(); line++)
 	{
-		// Extract text before newline
-		foundNL = ContainsNewLine(textRemaining);
-		curLineText = textRemaining.substr(0, foundNL.second);
-		_text.setString(curLineText);
-		if (foundNL.first) { textRemaining = textRemaining.substr(foundNL.second + 1); } //+1 to skip newline character
-
-		// Center, position and print each line separately
-		textBox = _text.getLocalBounds();
-		_text.setOrigin(sf::Vector2f(textBox.left + roundf(0.5f * (textBox.width)), textBox.top + roundf(0.5f * (textBox.height))));  // round to fix outline distortments
-		curLineVerticalAlignment = (alignment.y + lineCount++ * (static_cast<float>(size + lineSpacing) / static_cast<float>(rWindow.getSize().y)));
-		_text.setPosition(sf::Vector2f(roundf(rWindow.getSize().x * alignment.x), roundf(rWindow.getSize().y * curLineVerticalAlignment)));  // round to fix outline distortments
-		rWindow.draw(_text);
+		auto curLineVerticalAlignment = alignment.y + line * (static_cast<float>(size + lineSpacing) / windowSize.y);
+		rLines[line].setPosition(sf::Vector2f(roundf(windowSize.x * alignment.x), roundf(windowSize.y * curLineVerticalAlignment)));  // round to fix outline distortments
+		rWindow.draw(rLines[line]);
 	}
-	while (foundNL.first);
 }
 
 void PrintText(sf::RenderWindow& rWindow, sf::Vector2f alignment, std::string text, int size, sf::Color color, sf::Color outlineColor, float outlineThickness, FontStyle font, TextStyle style, float lineSpacing)
@@ -4,6 +4,7 @@
 
 #include <SFML\Graphics\RenderWindow.hpp>
 #include <SFML\Graphics\Text.hpp>
+#include <cstdint>
 
 enum class FontStyle { DEFAULT, SYMMETRIC };
 enum class TextStyle { REGULAR = sf::Text::Style::Regular, BOLD = sf::Text::Style::Bold };
@@ -12,7 +13,16 @@ static constexpr auto DEFAULT_TEXT_STYLE = TextStyle::REGULAR;
 static inline const auto DEFAULT_TEXT_COLOR = sf::Color::White;
 static inline const auto DEFAULT_TEXT_OUTLINE_COLOR = sf::Color::Black;
 
+struct TextLayoutCacheStats
+{
+	std::uint64_t hits;
+	std::uint64_t misses;
+};
+
 std::string GetFontPath(std::string filename);
+sf::Font& GetFont(FontStyle font);
+// PrintText() keeps the laid out lines of recently printed text, keyed by everything but position
+TextLayoutCacheStats GetTextLayoutCacheStats();
 void PrintText(sf::RenderWindow& rWindow, sf::Vector2f alignment, std::string text, int size, sf::Color color, sf::Color outlineColor, float outlineThickness, sf::Font& customFont, TextStyle style = DEFAULT_TEXT_STYLE, float lineSpacing = 0.0f);
 void PrintText(sf::RenderWindow& rWindow, sf::Vector2f alignment, std::string text, int size, sf::Color color, sf::Color outlineColor, float outlineThickness, FontStyle font = DEFAULT_FONT_STYLE, TextStyle style = DEFAULT_TEXT_STYLE, float lineSpacing = 0.0f);
 void PrintText(sf::RenderWindow& rWindow, sf::Vector2f alignment, std::string text, int size, sf::Color color, sf::Font& customFont, TextStyle style = DEFAULT_TEXT_STYLE, float lineSpacing = 0.0f);
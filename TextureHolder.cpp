@@ -1,9 +1,17 @@
 #include "TextureHolder.h"
 #include "FileCheck.h"		// for FileExists()
+#include <algorithm>		// for sort() and transform()
+#include <cctype>			// for tolower()
+#include <filesystem>		// for recursive_directory_iterator
 
 static constexpr auto GRAPHICS_DIRECTORY = "Graphics/";
 static constexpr auto IMAGE_FILE_EXTENSION = ".png";
 static constexpr auto SMOOTH_TEXTURE_MIN_SIZE = 550;
+// Anything bigger is a screen background or page, drawn on its own anyway
+static constexpr auto ATLAS_MAX_IMAGE_SIZE = 256u;
+static constexpr auto ATLAS_PAGE_SIZE = 1024u;
+// Transparent gap around every image, so rotated sprites never sample their neighbours
+static constexpr auto ATLAS_IMAGE_PADDING = 2u;
 
 sf::Texture& TextureHolder::GetTexture(std::string const& filepath)
 {
@@ -40,13 +48,88 @@ std::string TextureHolder::GetPath(std::string filename, std::string directory)
 
 void TextureHolder::Set(sf::Sprite& rSprite, std::string filepath, sf::Vector2f pos)
 {
+	auto& rHolder = Instance();
+	if (!rHolder.m_AtlasBuilt) { BuildAtlas(); }
+
 	if (FileExists(filepath))
 	{
-		rSprite = sf::Sprite(TextureHolder::GetTexture(filepath));
+		auto entry = rHolder.m_AtlasEntries.find(GetAtlasKey(filepath));
+		if (entry != rHolder.m_AtlasEntries.end()) { rSprite = sf::Sprite(rHolder.m_AtlasPages[entry->second.page], entry->second.rect); }
+		else { rSprite = sf::Sprite(TextureHolder::GetTexture(filepath)); }
 
 		// Center the origin
 		rSprite.setOrigin(0.5f * rSprite.getGlobalBounds().width, 0.5f * rSprite.getGlobalBounds().height);
 
 		rSprite.setPosition(pos);
 	}
+}
+
+// Shelf packing, tallest images first: each shelf is as tall as its first image and filled left to right
+void TextureHolder::BuildAtlas()
+{
+	auto& rHolder = Instance();
+	rHolder.m_AtlasBuilt = true;
+
+	struct PackedImage
+	{
+		std::string key;
+		sf::Image image;
+		int page;
+		sf::Vector2u pos;
+	};
+	std::vector<PackedImage> images;
+
+	std::error_code error;
+	for (const auto& file : std::filesystem::recursive_directory_iterator(GRAPHICS_DIRECTORY, error))
+	{
+		if (!file.is_regular_file() || file.path().extension() != IMAGE_FILE_EXTENSION) { continue; }
+		sf::Image image;
+		if (!image.loadFromFile(file.path().string())) { continue; }
+		if (image.getSize().x > ATLAS_MAX_IMAGE_SIZE || image.getSize().y > ATLAS_MAX_IMAGE_SIZE) { continue; }
+		images.push_back({ GetAtlasKey(file.path().generic_string()), image, 0, sf::Vector2u() });
+	}
+	std::sort(images.begin(), images.end(), [](const PackedImage& a, const PackedImage& b) { return a.image.getSize().y > b.image.getSize().y; });
+
+	auto page = 0;
+	sf::Vector2u cursor;
+	auto shelfHeight = 0u;
+	for (auto& rImage : images)
+	{
+		auto size = rImage.image.getSize() + sf::Vector2u(2 * ATLAS_IMAGE_PADDING, 2 * ATLAS_IMAGE_PADDING);
+		// Next shelf ?
+		if (cursor.x + size.x > ATLAS_PAGE_SIZE)
+		{
+			cursor = sf::Vector2u(0, cursor.y + shelfHeight);
+			shelfHeight = 0;
+		}
+		// Next page ?
+		if (cursor.y + size.y > ATLAS_PAGE_SIZE)
+		{
+			page++;
+			cursor = sf::Vector2u();
+			shelfHeight = 0;
+		}
+		rImage.page = page;
+		rImage.pos = cursor + sf::Vector2u(ATLAS_IMAGE_PADDING, ATLAS_IMAGE_PADDING);
+		cursor.x += size.x;
+		shelfHeight = std::max(shelfHeight, size.y);
+	}
+
+	// Upload every page once it is complete, the pages are never reallocated after this
+	std::vector<sf::Image> pageImages(images.empty() ? 0 : page + 1);
+	for (auto& rPageImage : pageImages) { rPageImage.create(ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE, sf::Color::Transparent); }
+	for (const auto& image : images)
+	{
+		pageImages[image.page].copy(image.image, image.pos.x, image.pos.y);
+		auto size = sf::Vector2i(image.image.getSize());
+		rHolder.m_AtlasEntries[image.key] = { image.page, sf::IntRect(sf::Vector2i(image.pos), size) };
+	}
+	rHolder.m_AtlasPages.resize(pageImages.size());
+	for (size_t i = 0; i < pageImages.size(); i++) { rHolder.m_AtlasPages[i].loadFromImage(pageImages[i]); }
+}
+
+std::string TextureHolder::GetAtlasKey(std::string filepath)
+{
+	std::transform(filepath.begin(), filepath.end(), filepath.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+	return filepath;
 }
\ No newline at end of file
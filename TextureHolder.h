@@ -4,13 +4,16 @@
 
 #include <SFML/Graphics.hpp>
 #include <map>
+#include <vector>
 
 class TextureHolder
 {
 public:
 	TextureHolder() = default;
+	// Always a texture of its own, for callers that use their own texture coordinates
 	static sf::Texture& GetTexture(std::string const& filepath);
 	static std::string GetPath(std::string filename, std::string directory = "");
+	// Small images are set as a rectangle of a shared atlas page, so sprites using them can be batched together
 	static void Set(sf::Sprite& rSprite, std::string filepath, sf::Vector2f pos);
 
 	// Delete these to ensure singleton
@@ -20,8 +23,23 @@ public:
 	void operator=(TextureHolder const&) = delete;	// copy assignment
 
 private:
+	struct AtlasEntry
+	{
+		int page;
+		sf::IntRect rect;
+	};
+
 	// A map container to hold filepaths and their corresponding Textures
 	std::map<std::string, sf::Texture> m_Textures;
+	// Every small image under the graphics directory, packed once on first use and never changed afterwards
+	// so sprites can keep pointers to the pages
+	std::vector<sf::Texture> m_AtlasPages;
+	// Keyed by lower case filepath, the filenames used in code dont always match the case of the files
+	std::map<std::string, AtlasEntry> m_AtlasEntries;
+	bool m_AtlasBuilt = false;
+
+	static void BuildAtlas();
+	static std::string GetAtlasKey(std::string filepath);
 	
 	// Meyer's Singleton
 	static TextureHolder& Instance()
@@ -100,10 +100,10 @@ void Throwable::Update(float dtAsSeconds)
 	}
 }
 
-void Throwable::Draw(sf::RenderWindow& rWindow) const
+void Throwable::Draw(RenderQueue& rQueue, DrawOrder order) const
 {
-	if (IsWeapon()) { if (IsLoaded()) { Weapon::Draw(rWindow); } }
-	else { Projectile::Draw(rWindow); }
+	if (IsWeapon()) { if (IsLoaded()) { Weapon::Draw(rQueue, order); } }
+	else { Projectile::Draw(rQueue, order); }
 }
 
 // Distinguish weapon instance from projectile instance of a throwable
@@ -147,7 +147,7 @@ void Throwable::WallDrop()
 
 		// Update floor coordinate
 		auto newFloor = GetPrimaryMovement() == Direction::UP ? BOTTOM_WALL : TOP_WALL; // primary movement flipped in HitWall()
-		auto distanceFromWall = GetRandomNumberBetween(THROWABLE_HIT_WALL_DROP_DIST_MIN, THROWABLE_HIT_WALL_DROP_DIST_MAX);
+		auto distanceFromWall = GetRandomNumberBetween(THROWABLE_HIT_WALL_DROP_DIST_MIN, THROWABLE_HIT_WALL_DROP_DIST_MAX, RandomStream::WEAPONS);
 		SetFloorCoordinate(newFloor + distanceFromWall);
 	}
 }
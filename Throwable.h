@@ -26,7 +26,7 @@ public:
 	virtual void Pause() final override;
 	virtual void Resume() final override;
 	virtual void Update(float dtAsSeconds) override;
-	virtual void Draw(sf::RenderWindow& rWindow) const final override;
+	virtual void Draw(RenderQueue& rQueue, DrawOrder order) const final override;
 
 protected:
 	// Projectile
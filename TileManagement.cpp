@@ -34,6 +34,12 @@ static int CalcPlayerColumnOnBoard(float playerPosX)
 	return column - WALL_THICKNESS_TILES;
 }
 
+// Tiles are stored column by column, four vertices each
+static unsigned int CalcFirstTileVertex(int column, int row)
+{
+	return (column * WINDOW_HEIGHT_TILES + row) * VERTICES_IN_QUAD;
+}
+
 // Returns which wall a given tile is part of
 // Corner cases are treated as part of top and bottom walls
 // Non-wall tiles will return Direction::NONE
@@ -80,55 +86,64 @@ void Game::CreateGates()
 	}
 }
 
-// Sets the tile vertex array using the tile layout array
+// Sets the tile vertex array and buffer using the tile layout array
+// Only needed once, changed tiles are updated on their own with UpdateTile()
 void Game::SetTVAfromTLA()
 {
 	// Use quads, need four vertices for each tile
 	m_Tiles.setPrimitiveType(sf::Quads);
 	m_Tiles.resize(WINDOW_WIDTH_TILES * WINDOW_HEIGHT_TILES * VERTICES_IN_QUAD);
 
-	// Start from first vertex in array
-	int curVertex = 0;
-
 	for (unsigned int column = 0; column < WINDOW_WIDTH_TILES; column++)
-	{
-		for (unsigned int row = 0; row < WINDOW_HEIGHT_TILES; row++)
-		{
-			auto posX = static_cast<float>(column);
-			auto posY = static_cast<float>(row);
-			// Position each vertex in current quad
-			//	0 -- 1
-			//	|    |
-			//	3 -- 2
-			m_Tiles[curVertex + 0].position = sf::Vector2f(posX, posY) * TILE_SIZE_PIXELS;
-			m_Tiles[curVertex + 1].position = sf::Vector2f(posX + 1, posY) * TILE_SIZE_PIXELS;
-			m_Tiles[curVertex + 2].position = sf::Vector2f(posX + 1, posY + 1) * TILE_SIZE_PIXELS;
-			m_Tiles[curVertex + 3].position = sf::Vector2f(posX, posY + 1) * TILE_SIZE_PIXELS;
-
-			// Calculate offset using sprite sheet tile value
-			auto verticalOffset = TILE_SIZE_PIXELS * m_TileLayout[row][column];
-
-			// Determine tile rotation
-			// Top wall and non-wall tiles dont need to be rotated
-			auto wall = WhichWall(column, row);
-			int rotationOffset = 0;
-			// Right wall
-			if (wall == Direction::RIGHT) { rotationOffset = 1; }
-			// Bottom wall
-			else if (wall == Direction::DOWN) { rotationOffset = 2; }
-			// Left wall
-			else if (wall == Direction::LEFT) { rotationOffset = 3; }
-
-			// Add texture to quad
-			m_Tiles[curVertex + (0 + rotationOffset) % VERTICES_IN_QUAD].texCoords = sf::Vector2f(0.0f, verticalOffset);
-			m_Tiles[curVertex + (1 + rotationOffset) % VERTICES_IN_QUAD].texCoords = sf::Vector2f(TILE_SIZE_PIXELS, verticalOffset);
-			m_Tiles[curVertex + (2 + rotationOffset) % VERTICES_IN_QUAD].texCoords = sf::Vector2f(TILE_SIZE_PIXELS, TILE_SIZE_PIXELS + verticalOffset);
-			m_Tiles[curVertex + (3 + rotationOffset) % VERTICES_IN_QUAD].texCoords = sf::Vector2f(0.0f, TILE_SIZE_PIXELS + verticalOffset);
-
-			// First vertex of next quad
-			curVertex += VERTICES_IN_QUAD;
-		}
-	}
+		for (unsigned int row = 0; row < WINDOW_HEIGHT_TILES; row++) { SetTileQuad(column, row); }
+
+	// Upload once with static usage, without buffer support the vertex array is drawn instead
+	m_TileBuffer.setPrimitiveType(sf::Quads);
+	m_TileBuffer.setUsage(sf::VertexBuffer::Static);
+	if (sf::VertexBuffer::isAvailable() && m_TileBuffer.create(m_Tiles.getVertexCount())) { m_TileBuffer.update(&m_Tiles[0]); }
+}
+
+// Rewrites the quad of a tile whose layout value changed
+void Game::UpdateTile(int column, int row)
+{
+	SetTileQuad(column, row);
+	auto firstVertex = CalcFirstTileVertex(column, row);
+	if (m_TileBuffer.getVertexCount() > 0) { m_TileBuffer.update(&m_Tiles[firstVertex], VERTICES_IN_QUAD, firstVertex); }
+}
+
+void Game::SetTileQuad(int column, int row)
+{
+	auto firstVertex = CalcFirstTileVertex(column, row);
+	auto posX = static_cast<float>(column);
+	auto posY = static_cast<float>(row);
+	// Position each vertex in current quad
+	//	0 -- 1
+	//	|    |
+	//	3 -- 2
+	m_Tiles[firstVertex + 0].position = sf::Vector2f(posX, posY) * TILE_SIZE_PIXELS;
+	m_Tiles[firstVertex + 1].position = sf::Vector2f(posX + 1, posY) * TILE_SIZE_PIXELS;
+	m_Tiles[firstVertex + 2].position = sf::Vector2f(posX + 1, posY + 1) * TILE_SIZE_PIXELS;
+	m_Tiles[firstVertex + 3].position = sf::Vector2f(posX, posY + 1) * TILE_SIZE_PIXELS;
+
+	// Calculate offset using sprite sheet tile value
+	auto verticalOffset = TILE_SIZE_PIXELS * m_TileLayout[row][column];
+
+	// Determine tile rotation
+	// Top wall and non-wall tiles dont need to be rotated
+	auto wall = WhichWall(column, row);
+	int rotationOffset = 0;
+	// Right wall
+	if (wall == Direction::RIGHT) { rotationOffset = 1; }
+	// Bottom wall
+	else if (wall == Direction::DOWN) { rotationOffset = 2; }
+	// Left wall
+	else if (wall == Direction::LEFT) { rotationOffset = 3; }
+
+	// Add texture to quad
+	m_Tiles[firstVertex + (0 + rotationOffset) % VERTICES_IN_QUAD].texCoords = sf::Vector2f(0.0f, verticalOffset);
+	m_Tiles[firstVertex + (1 + rotationOffset) % VERTICES_IN_QUAD].texCoords = sf::Vector2f(TILE_SIZE_PIXELS, verticalOffset);
+	m_Tiles[firstVertex + (2 + rotationOffset) % VERTICES_IN_QUAD].texCoords = sf::Vector2f(TILE_SIZE_PIXELS, TILE_SIZE_PIXELS + verticalOffset);
+	m_Tiles[firstVertex + (3 + rotationOffset) % VERTICES_IN_QUAD].texCoords = sf::Vector2f(0.0f, TILE_SIZE_PIXELS + verticalOffset);
 }
 
 // Highlights tile the player is currently on (player can only walk on cell tiles)
@@ -151,6 +166,8 @@ void Game::HighlightPlayerTile()
 		// Add wall thickness to translate Sudoku board local row/column to global tile layout row/columnn
 		m_TileLayout[oldRow + WALL_THICKNESS_TILES][oldCol + WALL_THICKNESS_TILES] = DEFAULT_CELL_TILE_VALUE;
 		m_TileLayout[newRow + WALL_THICKNESS_TILES][newCol + WALL_THICKNESS_TILES] = HIGHLIGHTED_CELL_TILE_VALUE;
+		UpdateTile(oldCol + WALL_THICKNESS_TILES, oldRow + WALL_THICKNESS_TILES);
+		UpdateTile(newCol + WALL_THICKNESS_TILES, newRow + WALL_THICKNESS_TILES);
 	}
 }
 
@@ -60,7 +60,7 @@ void Game::Update(float dtAsSeconds)
 
 				// Spawn random sized wave from each gate
 				for (const auto& gate : m_Gates)
-					for (auto i = 0; i < GetRandomNumberBetween(MIN_ENEMY_WAVE_SIZE, MAX_ENEMY_WAVE_SIZE); i++)
+					for (auto i = 0; i < GetRandomNumberBetween(MIN_ENEMY_WAVE_SIZE, MAX_ENEMY_WAVE_SIZE, RandomStream::AI); i++)
 						m_Enemies.emplace_back(std::make_unique<Wanderer>(gate->GetPos(), gate->GetExitFacing()));
 			}
 			else { m_SmallEnemySpawnTimer.Decrement(dtAsSeconds); }
@@ -131,7 +131,6 @@ void Game::Update(float dtAsSeconds)
 
 		// Update tiles
 		HighlightPlayerTile();
-		SetTVAfromTLA();
 
 		// Havent won already ?
 		if (!alreadyWon)
@@ -2,7 +2,7 @@
 #ifndef WALLS_INFO
 #define WALLS_INFO
 
-#include "Board.h"		// for BOARD_SIZE
+#include "Board_info.h"	// for BOARD_SIZE
 #include "Tile_info.h"	// for TILE_SIZE_PIXELS
 
 static constexpr auto WALL_THICKNESS_TILES = 1; // update m_TileLayout in Game.h if this value changes
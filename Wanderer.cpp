@@ -21,7 +21,7 @@ Wanderer::Wanderer(sf::Vector2f startPos, Direction primMov) :
 void Wanderer::Wander()
 {
 	// Move in random direction at normal speed
-	SetPrimaryMovement(GetRandomDirection());
+	SetPrimaryMovement(GetRandomDirection(RandomStream::AI));
 	SetPrimarySpeed(WANDERER_PRIMARY_SPEED);
 	SetSecondaryMovement(DEFAULT_DIRECTION);
 	m_DirectionChangeTimer.Reset(WANDERER_WANDER_TIME);